@@ -22,6 +22,7 @@
 #pragma once
 
 #include <discordcoreloader/FoundationEntities.hpp>
+#include <discordcoreloader/Randomizer.hpp>
 
 namespace DiscordCoreLoader {
 
@@ -30,6 +31,40 @@ namespace DiscordCoreLoader {
 		JSON = 1///< Json text format.
 	};
 
+	enum class IOBackend : uint8_t {
+		Epoll = 0,///< Readiness-based epoll (or WSAPoll) reactor.
+		IoUring = 1///< Batched completion-based io_uring submissions, with TLS over memory BIOs.
+	};
+
+	enum class TransportType : uint8_t {
+		Tls = 0,///< TLS through OpenSSL, optionally offloaded to the kernel.
+		Plain = 1///< Plain TCP (ws://) - for benchmarking a bot on the same host, without encryption on either side.
+	};
+
+	/// The gateway events that the rate scheduler can emit after READY.
+	enum class GatewayEventType : uint8_t {
+		None = 0,
+		Message_Create = 1,
+		Typing_Start = 2
+	};
+
+	enum class ArrivalProcess : uint8_t {
+		Poisson = 0,///< Exponentially distributed gaps, at the current mean rate.
+		Uniform = 1///< Evenly spaced arrivals, at the current rate.
+	};
+
+	/// One open-loop stream of an event type, which every shard runs on its own from the moment that it is handed to an agent.
+	struct EventRateData {
+		GatewayEventType theEvent{ GatewayEventType::None };
+		ArrivalProcess theArrivals{ ArrivalProcess::Poisson };
+		double ratePerSecond{};
+		double rampToRatePerSecond{};///< The rate at the end of the ramp - equal to ratePerSecond when no ramp is configured.
+		uint64_t rampDurationInMs{};
+		uint64_t rampSteps{};///< Zero ramps linearly, anything else climbs in that many equal steps.
+		uint64_t burstSize{};///< Extra events queued all at once, every burstPeriodInMs.
+		uint64_t burstPeriodInMs{};
+	};
+
 	struct ConfigData {
 		std::string connectionIp{};
 		std::string connectionPort{};
@@ -47,6 +82,27 @@ namespace DiscordCoreLoader {
 		uint64_t meanForChannelCount{};
 		uint64_t stdDeviationForRoleCount{};
 		uint64_t meanForRoleCount{};
+		IOBackend ioBackend{ IOBackend::Epoll };
+		TransportType transport{ TransportType::Tls };
+		uint64_t identifyMaxConcurrency{ 1 };
+		uint64_t identifyIntervalInMs{ 5000 };
+		bool doWeUseReusePortListeners{ false };
+		bool doWeUseKernelTls{ false };///< Hands record encryption to the kernel after each handshake, wherever the kernel and cipher allow it.
+		uint64_t tlsSessionCacheSize{ 20480 };///< Sessions kept for stateful resumption - zero turns the server-side cache off.
+		bool doWeUseTlsSessionTickets{ true };///< Lets clients resume from stateless tickets, with no server-side state at all.
+		uint64_t workerCount{ 0 };///< Zero sizes the agent pool from workerCpuList when it is set, and from the hardware otherwise.
+		std::vector<uint64_t> workerCpuList{};///< Agent N is pinned to workerCpuList[N % size] - empty leaves every agent unpinned.
+		bool doWeUseNumaFirstTouch{ false };///< Re-allocates each shard's input buffer on its agent's thread, so that it lands on that node.
+		uint64_t heartbeatIntervalInMs{ 45000 };///< Sent in Hello - a shard that goes 1.5 intervals without a heartbeat is closed with 4009.
+		uint64_t handshakeTimeoutInMs{ 10000 };///< How long a connection gets for TLS and the HTTP upgrade, before it is dropped.
+		uint64_t busyPollBudgetInUs{ 0 };///< How long an agent keeps polling without blocking after its last I/O - zero always blocks.
+		std::vector<EventRateData> eventRates{};///< Open-loop event streams that every shard runs after READY - empty sends none.
+		uint64_t listenBacklog{ 4096 };
+		uint64_t maxFrameSizeInBytes{ 1024 * 1024 };///< The longest payload that a client frame may declare, before it is closed with 1009.
+		RandomEngineType randomEngine{ RandomEngineType::Xoshiro256StarStar };
+		uint64_t seed{ 0 };///< Zero seeds from std::random_device, anything else makes the generated workload reproducible.
+		uint64_t guildCorpusDiversity{ 64 };///< The number of distinct guilds to pre-generate, capped at guildQuantity.
+		std::string guildCorpusPath{};///< Where the corpus is mapped from, or written to when it is missing or stale - empty keeps it in memory.
 	};
 
 	class ConfigParser {
@@ -55,7 +111,8 @@ namespace DiscordCoreLoader {
 
 		ConfigParser() = default;
 
-		ConfigData getTheData();
+		/// Parsed once at startup and never written again, so every thread may read through this reference.
+		const ConfigData& getTheData() const noexcept;
 
 	  protected:
 		ConfigData theData{};
@@ -63,6 +63,48 @@ namespace DiscordCoreLoader {
 
 	void atexitHandler();
 
+	enum class AcceptorStage : int8_t {
+		Upgrading = 0,///< Completing the TLS handshake and waiting for the HTTP upgrade request.
+		Identifying = 1///< Hello has been sent, waiting for a rate-limited Identify to produce READY.
+	};
+
+	struct PendingShard {
+		std::unique_ptr<WebSocketSSLShard> theShard{};
+		AcceptorStage theStage{ AcceptorStage::Upgrading };
+	};
+
+	class DiscordCoreClient;
+
+	/// Accepts connections from one listening socket and drives them through TLS, upgrade, Hello and Identify, before handing
+	/// each one off to the BaseSocketAgent that owns its shard.
+	class ShardAcceptor {
+	  public:
+		ShardAcceptor(DiscordCoreClient* discordCoreClientNew, SOCKET theListenerNew, SSL_CTX* theContextNew, bool doWeInstantiateAThread);
+
+		void processShards() noexcept;
+
+		~ShardAcceptor() noexcept;
+
+	  protected:
+		static constexpr int32_t maxIdleWaitInMs{ 100 };///< Bounds an idle wait, so that a quit flag set without a wake is still seen.
+		EventReactor theReactor{};///< Declared ahead of pendingShards, so that it outlives them.
+		TimerWheel theTimers{};///< Declared ahead of pendingShards, so that it outlives their handshake timers.
+		std::unique_ptr<BaseSocketAgent> theAgent{ nullptr };
+		std::unordered_map<WebSocketSSLShard*, PendingShard> pendingShards{};
+		DiscordCoreClient* discordCoreClient{ nullptr };
+		SOCKETWrapper theOwnedListener{};
+		SOCKET theListener{ static_cast<SOCKET>(SOCKET_ERROR) };
+		bool isListenerWatched{ false };///< Without it (WSAPoll), waits stay at a millisecond so that new connections are still seen.
+		SSL_CTXWrapper theContext{};
+		std::unique_ptr<std::jthread> theTask{ nullptr };
+
+		void acceptNewShards() noexcept;
+
+		void advancePendingShards() noexcept;
+
+		void handOffShard(PendingShard& thePendingShard) noexcept;
+	};
+
 	/**
 	 * \addtogroup main_endpoints
 	 * @{
@@ -71,6 +113,7 @@ namespace DiscordCoreLoader {
 	class DiscordCoreClient {
 	  public:
 		friend class BaseSocketAgent;
+		friend class ShardAcceptor;
 
 		/// DiscordCoreClient constructor. \brief DiscordCoreClient constructor.
 		/// \param configFilePath A string containing the path to the config file.
@@ -80,10 +123,12 @@ namespace DiscordCoreLoader {
 		void runServer();
 
 	  protected:
-		StopWatch<std::chrono::milliseconds> connectionStopWatch{ std::chrono::milliseconds{ 5000 } };
+		std::unique_ptr<GuildCorpus> guildCorpus{ nullptr };///< Declared ahead of the agents, so that their queued templates outlive them.
 		std::unordered_map<int32_t, std::unique_ptr<BaseSocketAgent>> baseSocketAgentMap{};
+		std::unique_ptr<IdentifyRateLimiter> identifyRateLimiter{ nullptr };
 		std::unique_ptr<WebSocketSSLServerMain> webSocketSSLServerMain{ nullptr };
-		bool haveWeCollectedShardingInfo{ false };
+		std::vector<std::unique_ptr<ShardAcceptor>> theAcceptors{};///< Declared after the agents, so that their threads stop first.
+		std::atomic_bool haveWeCollectedShardingInfo{ false };
 		std::atomic_uint32_t currentShardIndex{};
 		std::atomic_uint32_t totalShardCount{};
 		std::atomic_int32_t workerCount{ -1 };
@@ -98,7 +143,10 @@ namespace DiscordCoreLoader {
 		JSONIFier jsonifier{};
 
 
-		void connectShard();
+		BaseSocketAgent* getBaseSocketAgent(int32_t theIndex);
+
+		/// WorkerCount, or else the size of WorkerCpuList, or else the hardware's thread count - before Identify caps it at the shard count.
+		uint64_t getConfiguredWorkerCount() noexcept;
 	};
 	/**@}*/
 }// namespace DiscordCoreLoader
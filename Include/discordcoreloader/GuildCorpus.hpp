@@ -0,0 +1,116 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// GuildCorpus.hpp - Header file for the pre-serialized guild corpus.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file GuildCorpus.hpp
+
+#pragma once
+
+#include <discordcoreloader/FoundationEntities.hpp>
+#include <discordcoreloader/ConfigParser.hpp>
+#include <discordcoreloader/SSLClients.hpp>
+#include <discordcoreloader/JSONIfier.hpp>
+
+namespace DiscordCoreLoader {
+
+	/// A GUILD_CREATE payload serialized once per corpus slot and mode, along with the offsets of each of its snowflakes - every send
+	/// copies the bytes, splices in the sequence number, and overwrites the fixed-width ids in place.
+	struct GuildTemplate {
+		std::string_view theBytes{};
+		const uint64_t* theOffsets{ nullptr };///< The offsets of every id, grouped by id.
+		const uint64_t* theGroupEnds{ nullptr };///< The end of each id's group within theOffsets.
+		uint64_t theGroupCount{};
+		uint64_t theInsertOffset{};
+		uint64_t theIdLength{};
+	};
+
+	/// The header of a corpus file - it is followed by two CorpusTemplateRecords per slot (Json, then Etf), and then by the 8-byte
+	/// aligned sections that they point into. Every value is stored in host byte order.
+	struct CorpusFileHeader {
+		char theMagic[8]{};
+		uint64_t theVersion{};
+		uint64_t theFingerprint{};
+		uint64_t theDigest{};
+		uint64_t theSlotCount{};
+	};
+
+	/// Byte offsets from the start of the file, and element counts, of one serialized template.
+	struct CorpusTemplateRecord {
+		uint64_t theBytesOffset{};
+		uint64_t theBytesLength{};
+		uint64_t theOffsetsOffset{};
+		uint64_t theOffsetCount{};
+		uint64_t theGroupEndsOffset{};
+		uint64_t theGroupCount{};
+		uint64_t theInsertOffset{};
+		uint64_t theIdLength{};
+	};
+
+	/// A read-only, shared mapping of a whole file.
+	class MappedFile {
+	  public:
+		MappedFile() noexcept = default;
+
+		MappedFile& operator=(MappedFile&&) = delete;
+
+		MappedFile(MappedFile&&) = delete;
+
+		bool map(const std::string& thePath) noexcept;
+
+		const char* data() const noexcept;
+
+		uint64_t size() const noexcept;
+
+		void unmap() noexcept;
+
+		~MappedFile() noexcept;
+
+	  protected:
+		const char* theData{ nullptr };
+		uint64_t theSize{};
+	};
+
+	/// A pool of distinct GUILD_CREATE templates that is generated across all cores, or mapped from a corpus file written by an earlier
+	/// run, and then shared read-only by every agent.
+	class GuildCorpus {
+	  public:
+		GuildCorpus(const ConfigData& configData);
+
+		const GuildTemplate& getTemplate(uint64_t theIndex, WebSocketMode theMode) const noexcept;
+
+		uint64_t getDigest() const noexcept;
+
+		uint64_t size() const noexcept;
+
+	  protected:
+		static constexpr char theMagic[8]{ 'D', 'C', 'L', 'G', 'U', 'I', 'L', 'D' };
+		static constexpr uint64_t theVersion{ 3 };
+		std::vector<GuildTemplate> theTemplates{};
+		MappedFile theMappedFile{};
+		std::string theImage{};
+		uint64_t theDigest{};
+
+		static uint64_t getFingerprint(const ConfigData& configData) noexcept;
+
+		bool parseImage(const char* theData, uint64_t theSize, uint64_t theFingerprint) noexcept;
+
+		/// Throws if any slot fails to build, rather than leaving a hole in the corpus.
+		void generateImage(const ConfigData& configData, uint64_t theFingerprint);
+
+		bool writeImage(const std::string& thePath) noexcept;
+	};
+}
@@ -36,9 +36,9 @@ namespace DiscordCoreLoader {
 
 		JSONIFier(JSONIFier&) noexcept = default;
 
-		JSONIFier& operator=(ConfigData&&);
+		JSONIFier& operator=(const ConfigData&);
 
-		JSONIFier(ConfigData&& configData);
+		JSONIFier(const ConfigData& configData);
 
 		Jsonifier JSONIFYUnavailableGuild(UnavailableGuild& theGuild);
 
@@ -0,0 +1,158 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// MonotonicArena.hpp - Header file for the per-agent monotonic arena.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file MonotonicArena.hpp
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+namespace DiscordCoreLoader {
+
+	/// A bump allocator over a chain of blocks - individual frees are no-ops, and release() drops everything at once. It is owned by a
+	/// single thread, so it never takes a lock.
+	class MonotonicArena {
+	  public:
+		static constexpr uint64_t theDefaultBlockSize{ 64 * 1024 };
+
+		MonotonicArena(uint64_t theBlockSizeNew = MonotonicArena::theDefaultBlockSize) noexcept;
+
+		MonotonicArena& operator=(MonotonicArena&&) = delete;
+
+		MonotonicArena(MonotonicArena&&) = delete;
+
+		void* allocate(uint64_t theSize, uint64_t theAlignment);
+
+		/// Keeps the largest block for the next message, and frees the rest - debug builds abort if a tracked object is still alive.
+		void release() noexcept;
+
+		/// Counts objects from createInArena() that are still alive, so that debug builds can catch one that outlives its scope.
+		void trackObjects(int64_t theDelta) noexcept;
+
+		/// The arena that ArenaAllocator draws from on this thread, or nullptr outside of every ArenaScope.
+		static MonotonicArena* current() noexcept;
+
+	  protected:
+		friend class ArenaScope;
+
+		struct Block {
+			std::unique_ptr<char[]> theData{};
+			uint64_t theSize{};
+		};
+
+		std::vector<Block> theBlocks{};
+		int64_t theLiveObjectCount{};
+		uint64_t theBlockSize{};
+		uint64_t theOffset{};
+
+		void addBlock(uint64_t theMinimumSize);
+	};
+
+	/// Routes ArenaAllocator on the current thread into an arena until it goes out of scope, and then releases the arena - so it has to
+	/// be declared ahead of every value that allocates from it.
+	class ArenaScope {
+	  public:
+		ArenaScope(MonotonicArena& theArenaNew) noexcept;
+
+		ArenaScope& operator=(ArenaScope&&) = delete;
+
+		ArenaScope(ArenaScope&&) = delete;
+
+		~ArenaScope() noexcept;
+
+	  protected:
+		MonotonicArena* thePreviousArena{ nullptr };
+		MonotonicArena* theArena{ nullptr };
+	};
+
+	/// An allocator bound to one arena for its whole life - the current thread's arena when it is constructed, or the global heap
+	/// outside of every ArenaScope - so that it frees memory the same way it allocated it, whichever scope is current by then.
+	template<typename ValueType> class ArenaAllocator {
+	  public:
+		using value_type = ValueType;
+
+		ArenaAllocator(MonotonicArena* theArenaNew = MonotonicArena::current()) noexcept : theArena{ theArenaNew } {};
+
+		template<typename OtherType> ArenaAllocator(const ArenaAllocator<OtherType>& other) noexcept : theArena{ other.getArena() } {};
+
+		ValueType* allocate(std::size_t theCount) {
+			if (this->theArena) {
+				return static_cast<ValueType*>(this->theArena->allocate(theCount * sizeof(ValueType), alignof(ValueType)));
+			}
+			return std::allocator<ValueType>{}.allocate(theCount);
+		}
+
+		void deallocate(ValueType* thePointer, std::size_t theCount) noexcept {
+			if (!this->theArena) {
+				std::allocator<ValueType>{}.deallocate(thePointer, theCount);
+			}
+		}
+
+		MonotonicArena* getArena() const noexcept {
+			return this->theArena;
+		}
+
+		template<typename OtherType> bool operator==(const ArenaAllocator<OtherType>& other) const noexcept {
+			return this->theArena == other.getArena();
+		}
+
+	  protected:
+		MonotonicArena* theArena{ nullptr };
+	};
+
+	/// One object from createInArena(), behind the arena that it came from - which is nullptr for the global heap.
+	template<typename ValueType> struct alignas(std::max(alignof(ValueType), alignof(MonotonicArena*))) ArenaSlot {
+		MonotonicArena* theArena{ nullptr };
+		alignas(ValueType) std::byte theStorage[sizeof(ValueType)];
+	};
+
+	/// Constructs a ValueType with an ArenaAllocator bound to the current thread's arena, and records that arena alongside it.
+	template<typename ValueType> ValueType* createInArena() {
+		ArenaAllocator<ArenaSlot<ValueType>> theAllocator{};
+		auto theSlot = std::allocator_traits<ArenaAllocator<ArenaSlot<ValueType>>>::allocate(theAllocator, 1);
+		theSlot->theArena = theAllocator.getArena();
+		ValueType* theValue{ nullptr };
+		try {
+			theValue = new (theSlot->theStorage) ValueType{};
+		} catch (...) {
+			std::allocator_traits<ArenaAllocator<ArenaSlot<ValueType>>>::deallocate(theAllocator, theSlot, 1);
+			throw;
+		}
+		if (theSlot->theArena) {
+			theSlot->theArena->trackObjects(1);
+		}
+		return theValue;
+	}
+
+	/// Destroys a value from createInArena(), and frees it through an allocator bound to the arena that it was created in.
+	template<typename ValueType> void destroyInArena(ValueType* theValue) noexcept {
+		auto theSlot = reinterpret_cast<ArenaSlot<ValueType>*>(reinterpret_cast<std::byte*>(theValue) - offsetof(ArenaSlot<ValueType>, theStorage));
+		ArenaAllocator<ArenaSlot<ValueType>> theAllocator{ theSlot->theArena };
+		theValue->~ValueType();
+		if (theSlot->theArena) {
+			theSlot->theArena->trackObjects(-1);
+		}
+		std::allocator_traits<ArenaAllocator<ArenaSlot<ValueType>>>::deallocate(theAllocator, theSlot, 1);
+	}
+
+}
@@ -0,0 +1,96 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// MpscQueue.hpp - Header file for the lock-free multi-producer, single-consumer queue.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file MpscQueue.hpp
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace DiscordCoreLoader {
+
+	/// An intrusive, unbounded multi-producer single-consumer queue - a push is one atomic exchange, and a pop takes no atomic
+	/// read-modify-write at all. Any thread may push, but only the owning thread may pop.
+	template<typename ValueType> class MpscQueue {
+	  public:
+		MpscQueue() noexcept {
+			this->theHead.store(&this->theStub, std::memory_order_relaxed);
+			this->theTail = &this->theStub;
+		}
+
+		MpscQueue& operator=(MpscQueue&&) = delete;
+
+		MpscQueue(MpscQueue&&) = delete;
+
+		void push(ValueType&& theValue) {
+			this->pushNode(new Node{ {}, std::move(theValue) });
+		}
+
+		/// Returns false when the queue is empty, or when a producer is part of the way through a push - which the next call picks up.
+		bool tryPop(ValueType& theValue) noexcept {
+			auto theTailNode = this->theTail;
+			auto theNext = theTailNode->theNext.load(std::memory_order_acquire);
+			if (theTailNode == &this->theStub) {
+				if (!theNext) {
+					return false;
+				}
+				this->theTail = theNext;
+				theTailNode = theNext;
+				theNext = theNext->theNext.load(std::memory_order_acquire);
+			}
+			if (!theNext) {
+				if (theTailNode != this->theHead.load(std::memory_order_acquire)) {
+					return false;
+				}
+				this->pushNode(&this->theStub);
+				theNext = theTailNode->theNext.load(std::memory_order_acquire);
+				if (!theNext) {
+					return false;
+				}
+			}
+			this->theTail = theNext;
+			theValue = std::move(theTailNode->theValue);
+			delete theTailNode;
+			return true;
+		}
+
+		~MpscQueue() noexcept {
+			ValueType theValue{};
+			while (this->tryPop(theValue)) {
+			}
+		}
+
+	  protected:
+		struct Node {
+			std::atomic<Node*> theNext{ nullptr };
+			ValueType theValue{};
+		};
+
+		alignas(64) std::atomic<Node*> theHead{ nullptr };///< Producers swap themselves in here.
+		alignas(64) Node* theTail{ nullptr };///< Only ever touched by the consumer.
+		Node theStub{};
+
+		void pushNode(Node* theNode) noexcept {
+			theNode->theNext.store(nullptr, std::memory_order_relaxed);
+			auto thePrevious = this->theHead.exchange(theNode, std::memory_order_acq_rel);
+			thePrevious->theNext.store(theNode, std::memory_order_release);
+		}
+	};
+
+}
@@ -27,8 +27,30 @@
 
 namespace DiscordCoreLoader {
 
+	/// The independent random streams of a shard, when a fixed workload seed is configured.
+	enum class SeedStream : uint64_t {
+		Guild_Data = 0,///< The guild that is generated for a slot of the guild corpus.
+		Guild_Template = 1,///< The fresh ids of a corpus slot's GUILD_CREATE templates.
+		Ready = 2,///< The READY payload.
+		Event_Template = 3,///< An agent's pool of scheduled event templates.
+		Guild_Create = 4///< The first GUILD_CREATE - each following one uses the next stream.
+	};
+
+	/// Folds bytes into a 64-bit FNV-1a digest.
+	inline uint64_t digestCorpusBytes(std::string_view theBytes, uint64_t theDigest = 0xcbf29ce484222325ull) noexcept {
+		for (auto& value: theBytes) {
+			theDigest = (theDigest ^ static_cast<uint8_t>(value)) * 0x100000001b3ull;
+		}
+		return theDigest;
+	}
+
 	class ObjectGenerator : public Randomizer {
 	  public:
+		/// Reseeds the generator for one stream of a shard or corpus slot - a no-op unless a workload seed is configured.
+		void seedStream(uint64_t theKey, uint64_t theStream) noexcept;
+
+		std::string generateTimestamp();
+
 		std::unique_ptr<GuildMemberData> generateGuildMember(const std::string& guildId, const std::vector<std::unique_ptr<RoleData>>& roles);
 
 		UnavailableGuild generateUnavailableGuild(uint64_t minValue, uint64_t maxValue);
@@ -37,11 +59,19 @@ namespace DiscordCoreLoader {
 
 		std::unique_ptr<GuildData> generateGuild(std::string guildId);
 
+		/// Generates the guild of a corpus slot, from the slot's own stream when a workload seed is configured.
+		std::unique_ptr<GuildData> generateCorpusGuild(uint64_t theIndex);
+
 		std::unique_ptr<RoleData> generateRole(uint64_t position);
 
 		std::unique_ptr<UserData> generateUser();
 
+		/// Generates a message body, with the configured string length distribution.
+		std::string generateContent();
+
 	  protected:
+		static constexpr uint64_t fixedTimestampInMs{ 1420070400000 };
+		uint64_t theSeed{};
 		uint64_t stdDeviationForStringLength{};
 		uint64_t meanForStringLength{};
 		uint64_t stdDeviationForMemberCount{};
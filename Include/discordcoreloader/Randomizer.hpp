@@ -23,13 +23,64 @@
 
 #include <discordcoreloader/FoundationEntities.hpp>
 #include <charconv>
+#include <numbers>
+#include <random>
+#include <cmath>
+#include <array>
+#include <bit>
 
 namespace DiscordCoreLoader {
 
+	enum class RandomEngineType : uint8_t {
+		Xoshiro256StarStar = 0,///< xoshiro256** - 256 bits of state, and a period of 2^256 - 1.
+		WyRand = 1///< wyrand - a single 64-bit counter, mixed with one 128-bit multiply per output.
+	};
+
+	/// A small, lock-free 64-bit generator - each Randomizer owns one, so every agent thread draws from its own stream.
+	class RandomEngine {
+	  public:
+		using result_type = uint64_t;
+
+		RandomEngine(RandomEngineType theTypeNew = RandomEngineType::Xoshiro256StarStar, uint64_t theSeed = 0) noexcept;
+
+		static constexpr result_type min() noexcept {
+			return 0;
+		}
+
+		static constexpr result_type max() noexcept {
+			return UINT64_MAX;
+		}
+
+		void seed(uint64_t theSeed) noexcept;
+
+		result_type operator()() noexcept;
+
+	  protected:
+		std::array<uint64_t, 4> theState{};
+		RandomEngineType theType{};
+	};
+
 	class Randomizer {
 	  public:
+		static constexpr uint64_t idLength{ 18 };///< Every id from randomizeId() is exactly this long, so ids can be patched in place.
+
+		Randomizer() noexcept;
+
+		void setEngineType(RandomEngineType theType) noexcept;
+
+		void seed(uint64_t theSeed) noexcept;
+
+		/// Mixes a stream index into a base seed, so that independent streams never overlap.
+		static uint64_t deriveSeed(uint64_t theSeed, uint64_t theStream) noexcept;
+
 		void randomizeId(std::string& theString, uint64_t minValue = 0, uint64_t maxValue = UINT64_MAX);
 
+		void fillIds(std::string* theIds, uint64_t theCount, uint64_t minValue = 0, uint64_t maxValue = UINT64_MAX);
+
+		void fillBounded64BitUInts(uint64_t* theValues, uint64_t theCount, uint64_t minValue, uint64_t maxValue) noexcept;
+
+		void fillNormals(double* theValues, uint64_t theCount, double mean, double stdDeviation) noexcept;
+
 		uint64_t randomize64BitUInt(uint64_t minValue, uint64_t maxValue);
 
 		uint32_t randomize32BitUInt(uint32_t minValue, uint32_t maxValue);
@@ -40,6 +91,9 @@ namespace DiscordCoreLoader {
 
 		uint64_t randomize64BitUInt(double mean, double stdDeviation);
 
+		/// Draws the gap before the next arrival of a Poisson process with theRate arrivals per unit of time.
+		double randomizeExponential(double theRate) noexcept;
+
 		int8_t randomize8BitInt(uint8_t minValue, uint8_t maxValue);
 
 		uint64_t drawRandomValue(std::vector<uint64_t>&);
@@ -69,8 +123,13 @@ namespace DiscordCoreLoader {
 		int8_t randomize8BitInt();
 
 	  protected:
-		std::random_device randomDevice{};
-		std::mt19937_64 randomEngine{ this->randomDevice() };
-		std::recursive_mutex theMutex{};
+		static constexpr uint64_t normalCacheSize{ 256 };
+		std::array<double, normalCacheSize> theNormals{};
+		uint64_t currentNormalIndex{ normalCacheSize };
+		RandomEngine randomEngine{};
+
+		uint64_t randomizeBounded(uint64_t theRange) noexcept;
+
+		double randomizeUnitInterval() noexcept;
 	};
 }
\ No newline at end of file
@@ -59,10 +59,15 @@ extern "C" {
 	#include <netinet/tcp.h>
 	#include <stdint.h>
 	#include <sys/epoll.h>
+	#include <sys/eventfd.h>
+	#ifdef DISCORDCORELOADER_IO_URING
+		#include <liburing.h>
+	#endif
 	#include <poll.h>
 	#include <arpa/inet.h>
 	#include <sys/socket.h>
 	#include <sys/types.h>
+	#include <sys/uio.h>
 	#include <unistd.h>
 #endif
 
@@ -85,39 +90,108 @@ namespace DiscordCoreLoader {
 
 	enum class WebSocketMode : int8_t { JSON = 0, ETF = 1 };
 
-	struct PollFDWrapper {
-		std::vector<uint32_t> theIndices{};
+	struct GuildTemplate;
+	class BaseSocketAgent;
+	class SSLClient;
+
+#ifdef DISCORDCORELOADER_IO_URING
+	/// Per-socket state for the io_uring backend - owned by the reactor, so that in-flight buffers outlive their client.
+	struct IoUringSlot {
+		std::unique_ptr<char[]> recvBuffer{ std::make_unique<char[]>(1024 * 16) };
+		SSLClient* theClient{ nullptr };
+		std::string sendBuffer{};///< Owned by the in-flight send - never touched until its completion arrives.
+		std::string stagingBuffer{};///< Collects the write BIO's output, and becomes sendBuffer once that has been fully sent.
+		bool isRecvPending{ false };
+		bool isSendPending{ false };
+		uint64_t sendOffset{ 0 };
+		SOCKET theSocket{};
+	};
+#endif
+
+	/// A persistent readiness reactor - sockets are registered once, and only the ready ones are returned from processIO().
+	class EventReactor {
+	  public:
+		EventReactor& operator=(EventReactor&&) = delete;
+
+		EventReactor(EventReactor&&) = delete;
+
+		EventReactor& operator=(const EventReactor&) = delete;
+
+		EventReactor(const EventReactor&) = delete;
+
+		EventReactor(IOBackend theBackend = IOBackend::Epoll) noexcept;
+
+		bool registerClient(SSLClient* theClient) noexcept;
+
+		/// Watches a listening socket, so that an incoming connection ends the wait - the owner accepts after each processIO().
+		bool registerListener(SOCKET theListener) noexcept;
+
+		void unregisterClient(SSLClient* theClient) noexcept;
+
+		void setWriteInterest(SSLClient* theClient, bool doWeWantToWrite) noexcept;
+
+		/// A negative timeout blocks until there is I/O, or until another thread calls wake().
+		std::vector<SSLClient*> processIO(int32_t timeoutInMs, std::vector<SSLClient*>* theReadyClients = nullptr) noexcept;
+
+		/// Cuts the current (or next) wait short - safe to call from any thread, and coalesced until the reactor wakes up.
+		void wake() noexcept;
+
+		~EventReactor() noexcept;
+
+	  protected:
+		static constexpr int32_t maxEventsPerWait{ 1024 };
+		std::atomic_bool isWakePending{ false };
+#ifdef DISCORDCORELOADER_IO_URING
+		static constexpr uint64_t maxSendBacklog{ 1024 * 256 };
+		static constexpr uint32_t ringEntryCount{ 4096 };
+		static constexpr uint64_t wakeUserData{ ~uint64_t{ 0 } };
+		uint64_t theWakeValue{};
+		std::unordered_map<uint64_t, std::unique_ptr<IoUringSlot>> theSlots{};
+		std::unordered_map<SSLClient*, uint64_t> theSlotIndices{};
+		std::unordered_set<uint64_t> theWritableSlots{};
+		std::unordered_set<uint64_t> theDirtySlots{};
+		bool isRingActive{ false };
+		uint64_t currentSlotId{};
+		io_uring theRing{};
+
+		std::vector<SSLClient*> processIOUring(int32_t timeoutInMs, std::vector<SSLClient*>* theReadyClients) noexcept;
+
+		io_uring_sqe* getSubmissionEntry() noexcept;
+
+		void flushSlot(uint64_t theSlotId) noexcept;
+
+		void armRecv(uint64_t theSlotId) noexcept;
+
+		void armWake() noexcept;
+#endif
+#ifdef _WIN32
+		static constexpr int32_t maxPollWaitInMs{ 1 };///< WSAPoll has nothing that wake() could signal, so its waits stay short.
+		std::unordered_map<SSLClient*, uint64_t> theIndices{};
+		std::vector<SSLClient*> theClients{};
 		std::vector<pollfd> thePolls{};
+#else
+		std::vector<epoll_event> theEvents{};
+		int32_t epollFd{ -1 };
+		int32_t wakeFd{ -1 };
+
+		void drainWake() noexcept;
+#endif
 	};
-	class BaseSocketAgent;
 
 	struct MessagePackage {
 		std::vector<std::string> theStrings{};
 	};
 
+	/// An outbound message - either finished bytes, a GUILD_CREATE that stays a reference to its shared corpus template, plus the
+	/// data to patch into it, or a scheduled event - the last two are rendered at send time.
 	struct WebSocketMessage {
-		WebSocketMessage& operator=(WebSocketMessage&& other) noexcept {
-			this->stringMsg = std::move(other.stringMsg);
-			this->jsonMsg = std::move(other.jsonMsg);
-			this->theOpCode = other.theOpCode;
-			return *this;
-		}
-		WebSocketMessage(WebSocketMessage&& other) noexcept {
-			*this = std::move(other);
-		}
-		WebSocketMessage& operator=(const WebSocketMessage& other) noexcept {
-			this->theOpCode = other.theOpCode;
-			this->stringMsg = other.stringMsg;
-			this->jsonMsg = other.jsonMsg;
-			return *this;
-		}
-		WebSocketMessage(const WebSocketMessage& other) noexcept {
-			*this = other;
-		}
-		WebSocketMessage() = default;
+		const GuildTemplate* theTemplate{ nullptr };///< Owned by the guild corpus, which outlives every agent.
+		GatewayEventType theEventType{ GatewayEventType::None };
 		WebSocketOpCode theOpCode{};
-		Jsonifier jsonMsg{};
 		std::string stringMsg{};
+		std::string theIds{};///< One fixed-width snowflake per id group of the template.
+		int64_t theIntendedTimeInUs{};///< When the scheduler meant to emit the event, in microseconds since the Unix epoch.
+		int64_t theSequence{};
 	};
 
 	std::string reportError(const char* errorPosition, int32_t errorValue) noexcept;
@@ -167,6 +241,21 @@ namespace DiscordCoreLoader {
 		std::unique_ptr<SSL, SSLDeleter> ptr{ nullptr, SSLDeleter{} };
 	};
 
+	struct BIOWrapper {
+		struct BIODeleter {
+			void operator()(BIO* other);
+		};
+
+		BIOWrapper& operator=(BIO* other);
+
+		operator BIO*();
+
+		BIOWrapper() noexcept = default;
+
+	  protected:
+		std::unique_ptr<BIO, BIODeleter> ptr{ nullptr, BIODeleter{} };
+	};
+
 	struct SOCKETWrapper {
 		struct SOCKETDeleter {
 			void operator()(SOCKET* other);
@@ -232,7 +321,109 @@ namespace DiscordCoreLoader {
 		SOCKET returnIndex{};
 	};
 
-	enum class WebSocketState : int8_t { Initializing = 0, Connected = 1 };
+	enum class WebSocketState : int8_t {
+		Initializing = 0,
+		Connected = 1,
+		Closing = 2///< We have sent a close for a broken frame - anything else that the client sends is discarded.
+	};
+
+	enum class TransportStatus : uint8_t {
+		Complete = 0,///< Bytes moved, or there was nothing to move.
+		Retry = 1,///< The transport would block - try again on the next readiness event.
+		Closed = 2,///< The peer closed the connection.
+		Failed = 3///< The connection is unusable.
+	};
+
+	/// A receive buffer with separate read and write indices - bytes are consumed by advancing the read index, and the live bytes are only
+	/// moved back to the front once the tail runs out of room. The trailing padding allows simdjson to parse payloads in place.
+	class RingBuffer {
+	  public:
+		RingBuffer& operator=(RingBuffer&&) noexcept = default;
+
+		RingBuffer(RingBuffer&&) noexcept = default;
+
+		RingBuffer(uint64_t theCapacityNew = 1024 * 64) noexcept;
+
+		char* getWritePointer(uint64_t theSize) noexcept;
+
+		void commitWrite(uint64_t theSize) noexcept;
+
+		void consume(uint64_t theSize) noexcept;
+
+		uint64_t getPaddedSize() noexcept;
+
+		std::string_view getView() noexcept;
+
+		uint64_t size() noexcept;
+
+		char* data() noexcept;
+
+		void clear() noexcept;
+
+		/// Moves the live bytes into a fresh buffer, which the calling thread allocates and touches first.
+		void rehome() noexcept;
+
+	  protected:
+		std::unique_ptr<char[]> theBuffer{};
+		uint64_t theWriteIndex{};
+		uint64_t theReadIndex{};
+		uint64_t theCapacity{};
+	};
+
+	/// An outbound byte stream kept as a chain of 16 KB chunks - one TLS record each - so that frames are appended straight into
+	/// record-sized buffers, and large ones never need to be resliced. Drained chunks are kept for reuse.
+	class OutputChain {
+	  public:
+		static constexpr uint64_t theChunkSize{ 1024 * 16 };
+		static constexpr uint64_t theMaxFreeChunks{ 16 };
+
+		OutputChain& operator=(OutputChain&&) noexcept = default;
+
+		OutputChain(OutputChain&&) noexcept = default;
+
+		OutputChain() noexcept = default;
+
+		void append(const char* theData, uint64_t theSize);
+
+		/// Marks the position of the next appended byte, which patch() positions are relative to.
+		void markFrame() noexcept;
+
+		/// Overwrites bytes appended since markFrame() - valid until the next front() call.
+		void patch(uint64_t thePosition, const char* theData, uint64_t theSize) noexcept;
+
+		/// Seals the front chunk, so that a retried SSL_write sees exactly the same bytes, and returns its unwritten part.
+		std::string_view front() noexcept;
+
+		/// Advances past bytes that a (possibly partial) write accepted, and recycles the front chunk once it is drained.
+		void consume(uint64_t theSize) noexcept;
+
+		void popFront() noexcept;
+
+#ifdef __linux__
+		/// Points up to theMaxCount iovecs at the unwritten chunks, for a gathered send on a kernel TLS socket.
+		uint64_t gather(iovec* theVectors, uint64_t theMaxCount) noexcept;
+#endif
+
+		uint64_t size() noexcept;
+
+		void clear() noexcept;
+
+		/// Frees the recycled chunks, so that the next ones are allocated by the thread that appends to them.
+		void releaseFreeChunks() noexcept;
+
+	  protected:
+		struct Chunk {
+			std::unique_ptr<char[]> theData{};
+			uint64_t theSize{};
+			bool isSealed{ false };
+		};
+
+		std::vector<std::unique_ptr<char[]>> theFreeChunks{};
+		std::deque<Chunk> theChunks{};
+		uint64_t theFrontOffset{};
+		uint64_t theMarkOffset{};
+		uint64_t theMarkChunk{};
+	};
 
 	class BaseSocketAgent;
 
@@ -241,6 +432,8 @@ namespace DiscordCoreLoader {
 		friend class WebSocketSSLServerMain;
 		friend class DiscordCoreClient;
 		friend class BaseSocketAgent;
+		friend class ShardAcceptor;
+		friend class EventReactor;
 
 		SSLClient& operator=(SSLClient&& other) noexcept;
 
@@ -248,13 +441,14 @@ namespace DiscordCoreLoader {
 
 		SSLClient() noexcept = default;
 
-		SSLClient(SOCKET theSocket, SSL_CTX* theContextNew, bool doWePrintErrorsNew);
+		/// Everything above the transport functions is shared between TLS and plain TCP clients.
+		SSLClient(SOCKET theSocket, SSL_CTX* theContextNew, TransportType theTransportNew, bool doWePrintErrorsNew);
 
 		void writeData(std::string& data, bool priority) noexcept;
 
 		virtual void handleBuffer() noexcept = 0;
 
-		std::string& getInputBuffer() noexcept;
+		RingBuffer& getInputBuffer() noexcept;
 
 		bool areWeStillConnected() noexcept;
 
@@ -262,29 +456,47 @@ namespace DiscordCoreLoader {
 
 		bool writeDataProcess() noexcept;
 
+		bool writeGatheredProcess() noexcept;
+
 		bool readDataProcess() noexcept;
 
+		bool processHandshake() noexcept;
+
+		bool enableMemoryBIOs() noexcept;
+
+		bool hasTransport() noexcept;
+
+		BIO* getReadBio() noexcept;
+
+		BIO* getWriteBio() noexcept;
+
 		void disconnect() noexcept;
 
 		~SSLClient() noexcept;
 
 	  protected:
-		StopWatch<std::chrono::milliseconds> theStopWatch{ std::chrono::milliseconds{ 1 } };
+		EventReactor* theReactor{ nullptr };
+		bool doesHandshakeWantWrite{ false };
+		bool isHandshakeComplete{ false };
+		bool doWeWantToWrite{ false };
+		bool usesMemoryBIOs{ false };
+		bool isKernelTlsActive{ false };///< The kernel encrypts our records, so output bypasses SSL_write.
+		TransportType theTransport{ TransportType::Tls };
+		BIOWrapper plainWriteBio{};///< Only set alongside a memory read BIO - a socket BIO reads and writes.
+		BIOWrapper plainBio{};
 		WebSocketOpCode theOpCode{ WebSocketOpCode::Op_Binary };
 		std::deque<WebSocketMessage> theMessageQueue{};
+		static constexpr uint64_t maxWriteBudget{ 1024 * 256 };///< Bytes written per readiness event, so that no shard starves the rest.
 		const uint64_t maxBufferSize{ (1024 * 16) - 1 };
-		std::array<char, 1024 * 16> rawInputBuffer{};
 		SOCKETWrapper clientSocket{};
-		std::deque<std::string> outputBuffers{};
+		OutputChain outputChain{};
 		MessagePackage theCurrentMessage{};
 		int32_t currentReconnectTries{ 0 };
 		uint32_t currentSocketIndex{ 0 };
-		bool doWeHaveOurGuild{ false };
 		SSL_CTX* theContext{ nullptr };
 		std::string serverToClientBuffer{};
 		bool areWeConnected{ false };
 		bool doWePrintError{ false };
-		Jsonifier theGuildHolder{};
 		SSLWrapper ssl{};
 		int64_t currentGuildCount{};
 		WebSocketState theState{};
@@ -294,9 +506,19 @@ namespace DiscordCoreLoader {
 		int64_t totalGuildCount{};
 		int64_t lastNumberSent{};
 		uint64_t bytesRead{ 0 };
-		std::string inputBuffer{};
+		RingBuffer inputBuffer{};
 		uint32_t shard[2]{};
 		std::string authKey{};
+
+		bool doWeHaveDataToWrite() noexcept;
+
+		void updateWriteInterest() noexcept;
+
+		TransportStatus transportRead(char* theData, uint64_t theSize, uint64_t& theReadBytes) noexcept;
+
+		TransportStatus transportWrite(const char* theData, uint64_t theSize, uint64_t& theWrittenBytes) noexcept;
+
+		bool transportHasPending() noexcept;
 	};
 
 	struct ReconnectionPackage {
@@ -315,11 +537,23 @@ namespace DiscordCoreLoader {
 		WebSocketSSLServerMain(const std::string& theUrl, const std::string& port, bool doWePrintError, std::atomic_bool* doWeQuit,
 			ConfigParser* theData);
 
-		std::vector<WebSocketSSLShard*> processIO(std::vector<WebSocketSSLShard*>& theMap) noexcept;
+		SOCKET getNewSocket(SOCKET theListener);
+
+		SOCKET createListeningSocket();
+
+		bool doWeUseReusePort() noexcept;
+
+		/// Counts a completed handshake on a context that this server created.
+		static void recordHandshake(SSL* theSsl) noexcept;
+
+		uint64_t getFullHandshakeCount() noexcept;
 
-		SOCKET getNewSocket();
+		uint64_t getResumedHandshakeCount() noexcept;
 
 	  protected:
+		static constexpr char theSessionIdContext[]{ "DiscordCoreLoader" };
+		std::atomic_uint64_t theResumedHandshakeCount{};
+		std::atomic_uint64_t theFullHandshakeCount{};
 		std::queue<ReconnectionPackage> theReconnections{};
 		const int32_t maxBufferSize{ 1024 * 16 };
 		SOCKETWrapper theServerSocket{};
@@ -0,0 +1,99 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// TimerWheel.hpp - Header file for the per-agent hierarchical timer wheel.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file TimerWheel.hpp
+
+#pragma once
+
+#include <functional>
+#include <cstdint>
+#include <chrono>
+
+namespace DiscordCoreLoader {
+
+	class TimerWheel;
+
+	/// An intrusive timer - it lives inside whatever it times, so arming, re-arming and cancelling it never allocate, and destroying
+	/// it cancels it.
+	class TimerNode {
+	  public:
+		std::function<void()> onExpired{};///< Set once by the owner - re-arming the timer leaves it alone.
+
+		TimerNode& operator=(TimerNode&&) = delete;
+
+		TimerNode(TimerNode&&) = delete;
+
+		TimerNode() noexcept = default;
+
+		bool isArmed() const noexcept;
+
+		~TimerNode() noexcept;
+
+	  protected:
+		friend class TimerWheel;
+
+		TimerNode* thePrevious{ nullptr };
+		TimerNode* theNext{ nullptr };
+		TimerWheel* theWheel{ nullptr };
+		uint64_t theDeadline{};
+
+		void unlink() noexcept;
+	};
+
+	/// Four levels of 64 slots over a 1 ms tick, which covers about 4.6 hours - arming and cancelling are O(1), and each timer is
+	/// cascaded down at most three times before it fires. It is owned by a single thread, so it never takes a lock.
+	class TimerWheel {
+	  public:
+		static constexpr uint64_t theSlotBits{ 6 };
+		static constexpr uint64_t theSlotCount{ uint64_t{ 1 } << TimerWheel::theSlotBits };
+		static constexpr uint64_t theLevelCount{ 4 };
+
+		TimerWheel& operator=(TimerWheel&&) = delete;
+
+		TimerWheel(TimerWheel&&) = delete;
+
+		TimerWheel() noexcept;
+
+		/// (Re-)arms theTimer to fire no sooner than theDelay from now - and never from inside this call.
+		void schedule(TimerNode& theTimer, std::chrono::milliseconds theDelay) noexcept;
+
+		void cancel(TimerNode& theTimer) noexcept;
+
+		/// Fires every timer that is due, one at a time, so that a callback may freely arm, cancel or destroy any other timer.
+		void advance() noexcept;
+
+		/// How long the owner can block before the next timer is due - -1 when nothing is armed.
+		int32_t getTimeoutInMs() noexcept;
+
+		~TimerWheel() noexcept;
+
+	  protected:
+		std::chrono::steady_clock::time_point theStartTime{};
+		TimerNode theSlots[TimerWheel::theLevelCount][TimerWheel::theSlotCount]{};///< The sentinel of each slot's circular list.
+		TimerNode theExpired{};
+		uint64_t theCurrentTick{};
+		uint64_t theArmedCount{};
+
+		uint64_t getNowTick() noexcept;
+
+		void insert(TimerNode& theTimer) noexcept;
+
+		void cascade(uint64_t theLevel) noexcept;
+	};
+
+}
@@ -25,6 +25,10 @@
 #include <discordcoreloader/ErlParser.hpp>
 #include <discordcoreloader/SSLClients.hpp>
 #include <discordcoreloader/JSONIfier.hpp>
+#include <discordcoreloader/GuildCorpus.hpp>
+#include <discordcoreloader/MonotonicArena.hpp>
+#include <discordcoreloader/MpscQueue.hpp>
+#include <discordcoreloader/TimerWheel.hpp>
 
 namespace DiscordCoreLoader {
 
@@ -35,21 +39,63 @@ namespace DiscordCoreLoader {
 		int32_t currentShardIndex{ 0 };
 	};
 
+	/// Models Discord's max_concurrency identify buckets - shard N identifies within bucket N % maxConcurrency, and each bucket
+	/// admits one identify per interval.
+	class IdentifyRateLimiter {
+	  public:
+		IdentifyRateLimiter(uint64_t maxConcurrencyNew, uint64_t intervalInMsNew) noexcept;
+
+		bool tryAcquire(uint32_t theShard) noexcept;
+
+	  protected:
+		std::vector<std::chrono::steady_clock::time_point> theBuckets{};
+		std::chrono::milliseconds theInterval{};
+		std::mutex theMutex{};
+	};
+
+	/// The per-shard state of one configured event rate - its next arrivals are fixed in advance, and never pushed back by a slow bot.
+	struct EventStream {
+		std::chrono::steady_clock::time_point theNextArrival{};
+		std::chrono::steady_clock::time_point theNextBurst{};
+		const EventRateData* theRate{ nullptr };///< Owned by the agent.
+		TimerNode theArrivalTimer{};
+		TimerNode theBurstTimer{};
+		bool isItAnArrival{ false };///< False while the rate is zero, and theNextArrival is only a time to look again.
+	};
+
+	/// One scheduled event's dispatch, serialized once by its agent - every send splices in the sequence number, and then overwrites
+	/// fresh ids and the event's intended time in place.
+	struct EventTemplate {
+		std::vector<uint64_t> theIdOffsets{};
+		uint64_t theNonceOffset{};///< Zero when the event has no nonce - it is zero-padded to the width of an id.
+		uint64_t theUnixTimeOffset{};///< Zero when the event has no timestamp in seconds - it is always 10 digits, or an Etf int32.
+		uint64_t theInsertOffset{};
+		std::string theBytes{};
+	};
+
 	class WebSocketSSLShard : public SSLClient {
 	  public:
 		friend class WebSocketSSLServerMain;
 		friend class DiscordCoreClient;
 		friend class BaseSocketAgent;
+		friend class ShardAcceptor;
 
-		WebSocketSSLShard(SOCKET theSocket, SSL_CTX* theContext, bool doWePrintErrorsNew, BaseSocketAgent* theAgent);
+		WebSocketSSLShard(SOCKET theSocket, SSL_CTX* theContext, TransportType theTransportNew, bool doWePrintErrorsNew, BaseSocketAgent* theAgent);
 
 		void handleBuffer() noexcept;
 
 	  protected:
+		TimerNode theHeartbeatTimer{};///< Armed by the owning agent - a missed heartbeat times the session out with 4009.
+		TimerNode theHandshakeTimer{};///< Armed by the acceptor, from accept until Hello is sent.
+		std::chrono::steady_clock::time_point theEventStart{};
+		std::deque<EventStream> theEventStreams{};
 		BaseSocketAgent* theAgent{ nullptr };
+		bool haveWeTimedOut{ false };
 	};
 
 	enum class WebSocketCloseCode : uint16_t {
+		Protocol_Error = 1002,///< The frame violated RFC 6455 - for example, a client-to-server frame that was not masked.
+		Message_Too_Big = 1009,///< The frame declared a payload longer than MaxFrameSizeInBytes.
 		Unknown_Error = 4000,///< We're not sure what went wrong. Try reconnecting?
 		Unknown_Opcode = 4001,///< You sent an invalid Gateway opcode or an invalid payload for an opcode. Don't do that!
 		Decode_Error = 4002,///< You sent an invalid payload to us. Don't do that!
@@ -67,35 +113,60 @@ namespace DiscordCoreLoader {
 			4014///< You sent a disallowed intent for a Gateway Intent. You may have tried to specify an intent that you have not enabled.
 	};
 
+	enum class AgentCommandType : uint8_t { Add_Shard = 0 };
+
+	/// Something that another thread asks an agent to do, posted through its command queue and carried out on the agent's own thread.
+	struct AgentCommand {
+		std::unique_ptr<WebSocketSSLShard> theShard{};///< Set for Add_Shard.
+		AgentCommandType theType{};
+	};
+
 	class BaseSocketAgent : public ErlParser {
 	  public:
 		friend class DiscordCoreClient;
 		friend class WebSocketSSLShard;
 
 		BaseSocketAgent(WebSocketSSLServerMain* webSocketSSLServerMainNew, DiscordCoreClient* discordCoreClient, std::atomic_bool* doWeQuitNew,
-			bool doWeInstantiateAThread) noexcept;
+			int32_t theWorkerIndexNew, bool doWeInstantiateAThread) noexcept;
 
 		void sendMessage(Jsonifier&& dataToSend, WebSocketOpCode theOpCode, SSLClient* theShard, bool priority) noexcept;
 
 		void sendMessage(std::string* dataToSend, SSLClient* theShard, bool priority) noexcept;
 
+		void addShard(std::unique_ptr<WebSocketSSLShard> theShard) noexcept;
+
 		std::jthread* getTheTask() noexcept;
 
 		~BaseSocketAgent() noexcept;
 
 	  protected:
+		static constexpr int32_t maxIdleWaitInMs{ 100 };///< Bounds an idle wait, so that a quit flag set without a wake is still seen.
+		static constexpr int32_t closeGraceInMs{ 5000 };///< How long a timed-out client gets to close, before we drop it ourselves.
+		static constexpr std::chrono::milliseconds idleRateRecheck{ 100 };///< How often a stream whose rate is zero checks its ramp again.
+		static constexpr uint64_t eventTemplateVariants{ 16 };///< The distinct authors and contents that each event type and mode draws from.
+		EventReactor theReactor{};///< Declared ahead of theClients, so that it outlives them.
+		TimerWheel theTimers{};///< Declared ahead of theClients, so that it outlives their timers.
 		std::unordered_map<SOCKET, std::unique_ptr<WebSocketSSLShard>> theClients{};
 		std::unordered_map<SOCKET, std::vector<UnavailableGuild>> theGuilds{};
+		std::unordered_set<SOCKET> theActiveShards{};
+		MpscQueue<AgentCommand> theCommands{};///< The only way in for other threads - drained at the top of every loop iteration.
 		GatewayIntents intentsValue{ GatewayIntents::All_Intents };
 		WebSocketSSLServerMain* webSocketSSLServerMain{ nullptr };
 		std::unique_ptr<std::jthread> theTask{ nullptr };
 		DiscordCoreClient* discordCoreClient{ nullptr };
 		simdjson::ondemand::parser theParser{};
 		int32_t heartbeatInterval{ 45000 };
+		int32_t heartbeatTimeout{ 67500 };
+		uint64_t maxFrameSize{ 1024 * 1024 };
+		std::vector<EventRateData> theEventRates{};
+		std::unordered_map<uint64_t, std::vector<EventTemplate>> theEventTemplates{};///< Keyed by event type * 2 + mode.
 		std::atomic_bool* doWeQuit{ nullptr };
 		std::atomic_int32_t workerCount{ -1 };
 		int32_t currentClientSize{};
+		bool doWeUseNumaFirstTouch{ false };
+		int32_t theWorkerIndex{ -1 };///< This agent's slot in the worker pool, or -1 for an acceptor's agent, which is never pinned.
 		uint16_t closeCode{ 0 };
+		MonotonicArena theMessageArena{};///< Backs the Jsonifier tree of every payload that this agent builds, one message at a time.
 		JSONIFier jsonifier{};
 		std::string sessionId{};
 
@@ -104,7 +175,7 @@ namespace DiscordCoreLoader {
 
 		void createHeader(std::string& outBuffer, uint64_t sendLength, WebSocketOpCode opCodeNew) noexcept;
 
-		void onMessageReceived(WebSocketSSLShard* theShard, std::string& theString) noexcept;
+		void onMessageReceived(WebSocketSSLShard* theShard, std::string_view theString, uint64_t thePaddedSize) noexcept;
 
 		void initDisconnect(WebSocketCloseCode reason, SSLClient* theShard) noexcept;
 
@@ -114,14 +185,44 @@ namespace DiscordCoreLoader {
 
 		void sendCreateGuilds(SSLClient* theShard) noexcept;
 
+		void renderGuildCreate(const WebSocketMessage& theMessage, SSLClient* theShard) noexcept;
+
+		/// Renders the "s" key and value that get spliced into a template - Json's is followed by a comma.
+		void createSequence(std::string& outBuffer, int64_t theSequence, WebSocketOpCode opCodeNew) noexcept;
+
 		void sendReadyMessage(SSLClient* theShard) noexcept;
 
 		void sendFinalMessage(SSLClient* theShard) noexcept;
 
 		void sendHelloMessage(SSLClient* theShard) noexcept;
 
+		void sendInvalidSession(SSLClient* theShard) noexcept;
+
 		void sendHeartBeat(SSLClient* theShard) noexcept;
 
+		/// Re-arms the shard's heartbeat deadline, once it belongs to this agent.
+		void armHeartbeatTimer(WebSocketSSLShard* theShard) noexcept;
+
+		void onHeartbeatTimeout(WebSocketSSLShard* theShard) noexcept;
+
+		void startEventStreams(WebSocketSSLShard* theShard) noexcept;
+
+		/// Moves theNextArrival forward by one gap, at the rate that the stream's ramp gives at that point in time.
+		void advanceArrival(WebSocketSSLShard* theShard, EventStream& theStream) noexcept;
+
+		void onEventArrival(WebSocketSSLShard* theShard, EventStream& theStream) noexcept;
+
+		void onEventBurst(WebSocketSSLShard* theShard, EventStream& theStream) noexcept;
+
+		void queueEvent(WebSocketSSLShard* theShard, GatewayEventType theEvent, std::chrono::steady_clock::time_point theIntendedTime) noexcept;
+
+		/// Serializes eventTemplateVariants templates per mode, for each event type that theEventRates schedules.
+		void buildEventTemplates() noexcept;
+
+		bool buildEventTemplate(EventTemplate& theTemplate, GatewayEventType theEvent, WebSocketMode theMode);
+
+		void renderEvent(const WebSocketMessage& theMessage, SSLClient* theShard) noexcept;
+
 		void handleBuffer(SSLClient* theShard) noexcept;
 
 		bool parseHeader(SSLClient* theShard) noexcept;
@@ -130,6 +231,11 @@ namespace DiscordCoreLoader {
 
 		void run(std::stop_token theToken) noexcept;
 
-		void generateGuildData() noexcept;
+		/// Pins the calling thread to this agent's entry of the configured CPU list, if there is one.
+		void pinToWorkerCpu() noexcept;
+
+		void activateShards() noexcept;
+
+		void processCommands() noexcept;
 	};
 }// namespace DiscordCoreLoader
@@ -0,0 +1,459 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// WireSerializer.hpp - Header file for the direct struct-to-wire serializer.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file WireSerializer.hpp
+
+#pragma once
+
+#include <discordcoreloader/FoundationEntities.hpp>
+#include <charconv>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <bit>
+
+namespace DiscordCoreLoader {
+
+	/// One key of a type's wire representation, bound to the member that it is read from.
+	template<typename ClassType, typename MemberType> struct WireField {
+		std::string_view theKey{};
+		MemberType ClassType::*theMember{};
+	};
+
+	template<typename ClassType, typename MemberType>
+	constexpr WireField<ClassType, MemberType> wireField(std::string_view theKey, MemberType ClassType::*theMember) noexcept {
+		return { theKey, theMember };
+	}
+
+	/// Specialized for every type that goes out as an object - theFields lists its keys, in wire order.
+	template<typename ValueType> struct WireDescriptor;
+
+	template<typename ValueType>
+	concept WireDescribed = requires { WireDescriptor<ValueType>::theFields; };
+
+	template<typename ValueType>
+	concept WireTimeStamp = requires(ValueType& theValue) { theValue.getOriginalTimeStamp(); };
+
+	template<typename ValueType>
+	concept WirePointer = requires(ValueType& theValue) {
+		*theValue;
+		theValue == nullptr;
+	};
+
+	template<typename ValueType>
+	concept WireMap = std::ranges::range<ValueType> && requires { typename ValueType::mapped_type; };
+
+	/// The ids to watch for during a serialization - each string value that equals one of them has the offset of its first character
+	/// recorded in that id's group, as it is written.
+	struct WireIdRecorder {
+		std::unordered_map<std::string_view, uint64_t> theGroupIndices{};
+		std::unordered_map<int64_t, uint64_t> theIntegerGroupIndices{};///< The same for integers, recorded past the Etf tag byte.
+		std::vector<std::vector<uint64_t>> theOffsets{};///< One group per id, in ascending order of offset.
+	};
+
+	/// Serializes described structs straight into a caller-owned buffer, as Json or as Etf, without building a Jsonifier tree first.
+	class WireSerializer {
+	  public:
+		WireSerializer(std::string& theBufferNew, JsonifierSerializeType theTypeNew, WireIdRecorder* theIdRecorderNew = nullptr) noexcept
+			: theBuffer{ theBufferNew }, theType{ theTypeNew }, theIdRecorder{ theIdRecorderNew } {};
+
+		/// Appends one complete message - Etf messages lead with the format version.
+		template<typename ValueType> void serialize(ValueType& theValue) {
+			if (this->theType == JsonifierSerializeType::Etf) {
+				this->theBuffer.push_back(static_cast<char>(formatVersion));
+			}
+			this->write(theValue);
+		}
+
+		template<typename ValueType> void write(ValueType& theValue) {
+			using Type = std::remove_cvref_t<ValueType>;
+			if constexpr (std::same_as<Type, bool>) {
+				this->writeBool(theValue);
+			} else if constexpr (std::is_enum_v<Type>) {
+				this->writeInteger(static_cast<std::underlying_type_t<Type>>(theValue));
+			} else if constexpr (std::integral<Type>) {
+				this->writeInteger(theValue);
+			} else if constexpr (std::floating_point<Type>) {
+				this->writeFloat(static_cast<double>(theValue));
+			} else if constexpr (WireTimeStamp<Type>) {
+				this->writeString(theValue.getOriginalTimeStamp());
+			} else if constexpr (std::convertible_to<Type&, std::string_view>) {
+				this->writeString(theValue, true);
+			} else if constexpr (WireDescribed<Type>) {
+				this->writeObject(theValue);
+			} else if constexpr (WirePointer<Type>) {
+				if (theValue == nullptr) {
+					this->writeNull();
+				} else {
+					this->write(*theValue);
+				}
+			} else if constexpr (WireMap<Type>) {
+				this->writeArrayHeader(theValue.size());
+				bool isItFirst{ true };
+				for (auto& [key, value]: theValue) {
+					this->writeSeparator(std::exchange(isItFirst, false));
+					this->write(value);
+				}
+				this->writeArrayFooter();
+			} else if constexpr (std::ranges::range<Type>) {
+				this->writeArrayHeader(std::ranges::size(theValue));
+				bool isItFirst{ true };
+				for (auto& value: theValue) {
+					this->writeSeparator(std::exchange(isItFirst, false));
+					this->write(value);
+				}
+				this->writeArrayFooter();
+			} else {
+				this->writeString(static_cast<std::string>(theValue));
+			}
+		}
+
+	  protected:
+		std::string& theBuffer;
+		JsonifierSerializeType theType{};
+		WireIdRecorder* theIdRecorder{ nullptr };
+
+		template<typename ValueType> void writeObject(ValueType& theValue) {
+			constexpr auto& theFields = WireDescriptor<std::remove_cvref_t<ValueType>>::theFields;
+			if (this->theType == JsonifierSerializeType::Etf) {
+				char theHeader[5]{ static_cast<char>(EtfType::Map_Ext) };
+				storeBits(theHeader + 1, static_cast<uint32_t>(std::tuple_size_v<std::remove_cvref_t<decltype(theFields)>>));
+				this->theBuffer.append(theHeader, std::size(theHeader));
+			} else {
+				this->theBuffer.push_back('{');
+			}
+			bool isItFirst{ true };
+			std::apply(
+				[&](auto&... theField) {
+					((this->writeKey(theField.theKey, std::exchange(isItFirst, false)), this->write(theValue.*(theField.theMember))), ...);
+				},
+				theFields);
+			if (this->theType == JsonifierSerializeType::Json) {
+				this->theBuffer.push_back('}');
+			}
+		}
+
+		void writeKey(std::string_view theKey, bool isItFirst) {
+			if (this->theType == JsonifierSerializeType::Etf) {
+				this->writeString(theKey);
+			} else {
+				this->writeSeparator(isItFirst);
+				this->writeString(theKey);
+				this->theBuffer.push_back(':');
+			}
+		}
+
+		void writeSeparator(bool isItFirst) {
+			if (this->theType == JsonifierSerializeType::Json && !isItFirst) {
+				this->theBuffer.push_back(',');
+			}
+		}
+
+		void writeArrayHeader(uint64_t theSize) {
+			if (this->theType == JsonifierSerializeType::Etf) {
+				if (theSize > 0) {
+					char theHeader[5]{ static_cast<char>(EtfType::List_Ext) };
+					storeBits(theHeader + 1, static_cast<uint32_t>(theSize));
+					this->theBuffer.append(theHeader, std::size(theHeader));
+				}
+			} else {
+				this->theBuffer.push_back('[');
+			}
+		}
+
+		void writeArrayFooter() {
+			if (this->theType == JsonifierSerializeType::Etf) {
+				this->theBuffer.push_back(static_cast<char>(EtfType::Nil_Ext));
+			} else {
+				this->theBuffer.push_back(']');
+			}
+		}
+
+		void writeString(std::string_view theString, bool isItAValue = false) {
+			if (this->theType == JsonifierSerializeType::Etf) {
+				char theHeader[5]{ static_cast<char>(EtfType::Binary_Ext) };
+				storeBits(theHeader + 1, static_cast<uint32_t>(theString.size()));
+				this->theBuffer.append(theHeader, std::size(theHeader));
+			} else {
+				this->theBuffer.push_back('"');
+			}
+			if (isItAValue && this->theIdRecorder) {
+				if (auto theGroup = this->theIdRecorder->theGroupIndices.find(theString); theGroup != this->theIdRecorder->theGroupIndices.end()) {
+					this->theIdRecorder->theOffsets[theGroup->second].emplace_back(this->theBuffer.size());
+				}
+			}
+			this->theBuffer.append(theString);
+			if (this->theType == JsonifierSerializeType::Json) {
+				this->theBuffer.push_back('"');
+			}
+		}
+
+		template<std::integral ValueType> void writeInteger(ValueType theValue) {
+			if (this->theIdRecorder) {
+				if (auto theGroup = this->theIdRecorder->theIntegerGroupIndices.find(static_cast<int64_t>(theValue));
+					theGroup != this->theIdRecorder->theIntegerGroupIndices.end()) {
+					auto theOffset = this->theBuffer.size() + (this->theType == JsonifierSerializeType::Etf ? 1 : 0);
+					this->theIdRecorder->theOffsets[theGroup->second].emplace_back(theOffset);
+				}
+			}
+			if (this->theType == JsonifierSerializeType::Json) {
+				char theDigits[24]{};
+				auto theResult = std::to_chars(theDigits, theDigits + std::size(theDigits), theValue);
+				this->theBuffer.append(theDigits, theResult.ptr);
+			} else if (std::in_range<uint8_t>(theValue)) {
+				char theBytes[2]{ static_cast<char>(EtfType::Small_Integer_Ext), static_cast<char>(theValue) };
+				this->theBuffer.append(theBytes, std::size(theBytes));
+			} else if (std::in_range<int32_t>(theValue)) {
+				char theBytes[5]{ static_cast<char>(EtfType::Integer_Ext) };
+				storeBits(theBytes + 1, static_cast<int32_t>(theValue));
+				this->theBuffer.append(theBytes, std::size(theBytes));
+			} else {
+				char theBytes[11]{ static_cast<char>(EtfType::Small_Big_Ext) };
+				uint64_t theMagnitude = std::cmp_less(theValue, 0) ? 0 - static_cast<uint64_t>(theValue) : static_cast<uint64_t>(theValue);
+				uint8_t theByteCount{};
+				for (; theMagnitude > 0; theMagnitude >>= 8) {
+					theBytes[3 + theByteCount++] = static_cast<char>(theMagnitude & 0xFF);
+				}
+				theBytes[1] = static_cast<char>(theByteCount);
+				theBytes[2] = static_cast<char>(std::cmp_less(theValue, 0) ? 1 : 0);
+				this->theBuffer.append(theBytes, 3 + static_cast<uint64_t>(theByteCount));
+			}
+		}
+
+		void writeFloat(double theValue) {
+			if (this->theType == JsonifierSerializeType::Json) {
+				char theDigits[32]{};
+				auto theResult = std::to_chars(theDigits, theDigits + std::size(theDigits), theValue);
+				this->theBuffer.append(theDigits, theResult.ptr);
+			} else {
+				char theBytes[9]{ static_cast<char>(EtfType::New_Float_Ext) };
+				storeBits(theBytes + 1, std::bit_cast<uint64_t>(theValue));
+				this->theBuffer.append(theBytes, std::size(theBytes));
+			}
+		}
+
+		void writeBool(bool theValue) {
+			if (this->theType == JsonifierSerializeType::Json) {
+				this->theBuffer.append(theValue ? "true" : "false");
+			} else {
+				this->writeAtom(theValue ? "true" : "false");
+			}
+		}
+
+		void writeNull() {
+			if (this->theType == JsonifierSerializeType::Json) {
+				this->theBuffer.append("null");
+			} else {
+				this->writeAtom("nil");
+			}
+		}
+
+		void writeAtom(std::string_view theAtom) {
+			this->theBuffer.push_back(static_cast<char>(EtfType::Small_Atom_Ext));
+			this->theBuffer.push_back(static_cast<char>(theAtom.size()));
+			this->theBuffer.append(theAtom);
+		}
+	};
+
+	/// The envelope of a dispatch - d is written through the pointer, so that the payload itself is never copied.
+	template<typename ValueType> struct WireDispatch {
+		ValueType* d{ nullptr };
+		int8_t op{ 0 };
+		std::string_view t{};
+	};
+
+	template<typename ValueType> struct WireDescriptor<WireDispatch<ValueType>> {
+		using Type = WireDispatch<ValueType>;
+		static constexpr auto theFields = std::make_tuple(wireField("d", &Type::d), wireField("op", &Type::op), wireField("t", &Type::t));
+	};
+
+	/// Makes room in a serialized dispatch for the "s" that every send splices in at theInsertOffset - an Etf map has its arity raised
+	/// by one up front, so that only the key and value need to be inserted.
+	inline bool reserveSequenceSlot(std::string& theBytes, JsonifierSerializeType theType, uint64_t& theInsertOffset) noexcept {
+		if (theType == JsonifierSerializeType::Json) {
+			if (theBytes.size() < 2 || theBytes[0] != '{' || theBytes[1] == '}') {
+				return false;
+			}
+			theInsertOffset = 1;
+			return true;
+		}
+		if (theBytes.size() < 6 || static_cast<uint8_t>(theBytes[1]) != static_cast<uint8_t>(EtfType::Map_Ext)) {
+			return false;
+		}
+		uint32_t theArity{};
+		for (uint64_t x = 2; x < 6; ++x) {
+			theArity = (theArity << 8) | static_cast<uint8_t>(theBytes[x]);
+		}
+		storeBits(theBytes.data() + 2, theArity + 1);
+		theInsertOffset = 6;
+		return true;
+	}
+
+	/// The d of a MESSAGE_CREATE - the author points at a pooled user, so that it is never copied.
+	struct WireMessageCreate {
+		UserData* author{ nullptr };
+		std::string channelId{};
+		std::string content{};
+		std::string guildId{};
+		std::string id{};
+		bool mentionEveryone{ false };
+		std::string nonce{};
+		bool pinned{ false };
+		std::string timestamp{};
+		bool tts{ false };
+		int8_t type{ 0 };
+	};
+
+	/// The d of a TYPING_START.
+	struct WireTypingStart {
+		std::string channelId{};
+		std::string guildId{};
+		int64_t timestamp{};///< Unix time, in seconds.
+		std::string userId{};
+	};
+
+	template<> struct WireDescriptor<WireMessageCreate> {
+		using Type = WireMessageCreate;
+		static constexpr auto theFields = std::make_tuple(wireField("author", &Type::author), wireField("channel_id", &Type::channelId),
+			wireField("content", &Type::content), wireField("guild_id", &Type::guildId), wireField("id", &Type::id),
+			wireField("mention_everyone", &Type::mentionEveryone), wireField("nonce", &Type::nonce), wireField("pinned", &Type::pinned),
+			wireField("timestamp", &Type::timestamp), wireField("tts", &Type::tts), wireField("type", &Type::type));
+	};
+
+	template<> struct WireDescriptor<WireTypingStart> {
+		using Type = WireTypingStart;
+		static constexpr auto theFields = std::make_tuple(wireField("channel_id", &Type::channelId), wireField("guild_id", &Type::guildId),
+			wireField("timestamp", &Type::timestamp), wireField("user_id", &Type::userId));
+	};
+
+	template<> struct WireDescriptor<UserData> {
+		using Type = UserData;
+		static constexpr auto theFields = std::make_tuple(wireField("accent_color", &Type::accentColor), wireField("avatar", &Type::avatar),
+			wireField("banner", &Type::banner), wireField("bot", &Type::bot), wireField("discriminator", &Type::discriminator),
+			wireField("email", &Type::email), wireField("flags", &Type::flags), wireField("id", &Type::id), wireField("locale", &Type::locale),
+			wireField("mfa_enabled", &Type::mfaEnabled), wireField("premium_type", &Type::premiumType), wireField("public_flags", &Type::publicFlags),
+			wireField("system", &Type::system), wireField("username", &Type::userName), wireField("verified", &Type::verified));
+	};
+
+	template<> struct WireDescriptor<RoleTagsData> {
+		using Type = RoleTagsData;
+		static constexpr auto theFields = std::make_tuple(wireField("bot_id", &Type::botId), wireField("integration_id", &Type::integrationId),
+			wireField("premium_subscriber", &Type::premiumSubscriber));
+	};
+
+	template<> struct WireDescriptor<RoleData> {
+		using Type = RoleData;
+		static constexpr auto theFields = std::make_tuple(wireField("color", &Type::color), wireField("flags", &Type::flags),
+			wireField("hoist", &Type::hoist), wireField("icon", &Type::icon), wireField("id", &Type::id), wireField("managed", &Type::managed),
+			wireField("mentionable", &Type::mentionable), wireField("name", &Type::name), wireField("permissions", &Type::permissions),
+			wireField("position", &Type::position), wireField("tags", &Type::tags));
+	};
+
+	template<> struct WireDescriptor<GuildMemberData> {
+		using Type = GuildMemberData;
+		static constexpr auto theFields = std::make_tuple(wireField("avatar", &Type::avatar),
+			wireField("communication_disabled_until", &Type::communicationDisabledUntil), wireField("deaf", &Type::deaf),
+			wireField("flags", &Type::flags), wireField("guild_id", &Type::guildId), wireField("mute", &Type::mute), wireField("nick", &Type::nick),
+			wireField("pending", &Type::pending), wireField("permissions", &Type::permissions), wireField("premium_since", &Type::premiumSince),
+			wireField("roles", &Type::roles), wireField("user", &Type::user));
+	};
+
+	template<> struct WireDescriptor<OverWriteData> {
+		using Type = OverWriteData;
+		static constexpr auto theFields =
+			std::make_tuple(wireField("channel_id", &Type::channelId), wireField("id", &Type::id), wireField("type", &Type::type));
+	};
+
+	template<> struct WireDescriptor<ThreadMetadataData> {
+		using Type = ThreadMetadataData;
+		static constexpr auto theFields = std::make_tuple(wireField("archive_timestamp", &Type::archiveTimestamp),
+			wireField("archived", &Type::archived), wireField("auto_archive_duration", &Type::autoArchiveDuration),
+			wireField("invitable", &Type::invitable), wireField("locked", &Type::locked));
+	};
+
+	template<> struct WireDescriptor<ThreadMemberData> {
+		using Type = ThreadMemberData;
+		static constexpr auto theFields = std::make_tuple(wireField("flags", &Type::flags), wireField("id", &Type::id),
+			wireField("join_timestamp", &Type::joinTimestamp), wireField("user_id", &Type::userId));
+	};
+
+	template<> struct WireDescriptor<ChannelData> {
+		using Type = ChannelData;
+		static constexpr auto theFields = std::make_tuple(wireField("application_id", &Type::applicationId), wireField("bitrate", &Type::bitrate),
+			wireField("default_auto_archive_duration", &Type::defaultAutoArchiveDuration), wireField("flags", &Type::flags),
+			wireField("guild_id", &Type::guildId), wireField("icon", &Type::icon), wireField("id", &Type::id),
+			wireField("last_message_id", &Type::lastMessageId), wireField("last_pin_timestamp", &Type::lastPinTimestamp),
+			wireField("member", &Type::member), wireField("member_count", &Type::memberCount), wireField("message_count", &Type::messageCount),
+			wireField("name", &Type::name), wireField("owner_id", &Type::ownerId), wireField("parent_id", &Type::parentId),
+			wireField("permission_overwrites", &Type::permissionOverwrites), wireField("permissions", &Type::permissions),
+			wireField("position", &Type::position), wireField("rate_limit_per_user", &Type::rateLimitPerUser),
+			wireField("recipients", &Type::recipients), wireField("rtc_region", &Type::rtcRegion),
+			wireField("thread_metadata", &Type::threadMetadata), wireField("topic", &Type::topic), wireField("type", &Type::type),
+			wireField("user_limit", &Type::userLimit), wireField("video_quality_mode", &Type::videoQualityMode));
+	};
+
+	template<> struct WireDescriptor<ClientStatusData> {
+		using Type = ClientStatusData;
+		static constexpr auto theFields =
+			std::make_tuple(wireField("desktop", &Type::desktop), wireField("mobile", &Type::mobile), wireField("web", &Type::web));
+	};
+
+	template<> struct WireDescriptor<PresenceUpdateData> {
+		using Type = PresenceUpdateData;
+		static constexpr auto theFields = std::make_tuple(wireField("client_status", &Type::clientStatus), wireField("guild_id", &Type::guildId),
+			wireField("status", &Type::status), wireField("user", &Type::user));
+	};
+
+	template<> struct WireDescriptor<WelcomeScreenData> {
+		using Type = WelcomeScreenData;
+		static constexpr auto theFields = std::make_tuple(wireField("description", &Type::description));
+	};
+
+	template<> struct WireDescriptor<VoiceStateData> {
+		using Type = VoiceStateData;
+		static constexpr auto theFields = std::make_tuple(wireField("channel_id", &Type::channelId), wireField("deaf", &Type::deaf),
+			wireField("guild_id", &Type::guildId), wireField("member", &Type::member), wireField("mute", &Type::mute),
+			wireField("request_to_speak_timestamp", &Type::requestToSpeakTimestamp), wireField("self_deaf", &Type::selfDeaf),
+			wireField("self_mute", &Type::selfMute), wireField("self_stream", &Type::selfStream), wireField("self_video", &Type::selfVideo),
+			wireField("session_id", &Type::sessionId), wireField("suppress", &Type::suppress), wireField("user_id", &Type::userId));
+	};
+
+	template<> struct WireDescriptor<GuildData> {
+		using Type = GuildData;
+		static constexpr auto theFields = std::make_tuple(wireField("afk_channel_id", &Type::afkChannelId),
+			wireField("afk_time_out", &Type::afkTimeOut), wireField("application_id", &Type::applicationId),
+			wireField("approximate_member_count", &Type::approximateMemberCount),
+			wireField("approximate_presence_count", &Type::approximatePresenceCount), wireField("banner", &Type::banner),
+			wireField("channels", &Type::channels), wireField("default_message_notifications", &Type::defaultMessageNotifications),
+			wireField("description", &Type::description), wireField("discovery_splash", &Type::discoverySplash),
+			wireField("explicit_content_filter", &Type::explicitContentFilter), wireField("features", &Type::features),
+			wireField("flags", &Type::flags), wireField("icon", &Type::icon), wireField("icon_hash", &Type::iconHash), wireField("id", &Type::id),
+			wireField("max_members", &Type::maxMembers), wireField("max_presences", &Type::maxPresences),
+			wireField("max_video_channel_users", &Type::maxVideoChannelUsers), wireField("member_count", &Type::memberCount),
+			wireField("members", &Type::members), wireField("mfa_level", &Type::mfaLevel), wireField("name", &Type::name),
+			wireField("nsfw_level", &Type::nsfwLevel), wireField("owner_id", &Type::ownerId), wireField("permissions", &Type::permissions),
+			wireField("preferred_locale", &Type::preferredLocale), wireField("premium_subscription_count", &Type::premiumSubscriptionCount),
+			wireField("premium_tier", &Type::premiumTier), wireField("presences", &Type::presences),
+			wireField("public_updates_channel_id", &Type::publicUpdatesChannelId), wireField("region", &Type::region),
+			wireField("roles", &Type::roles), wireField("rules_channel_id", &Type::rulesChannelId), wireField("splash", &Type::splash),
+			wireField("system_channel_flags", &Type::systemChannelFlags), wireField("system_channel_id", &Type::systemChannelId),
+			wireField("vanity_url_code", &Type::vanityUrlCode), wireField("verification_level", &Type::verificationLevel),
+			wireField("voice_states", &Type::voiceStates), wireField("welcome_screen", &Type::welcomeScreen),
+			wireField("widget_channel_id", &Type::widgetChannelId));
+	};
+}
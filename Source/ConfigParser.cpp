@@ -30,7 +30,7 @@ namespace DiscordCoreLoader {
 		this->parseConfigData(configFilePath);
 	};
 
-	ConfigData ConfigParser::getTheData() {
+	const ConfigData& ConfigParser::getTheData() const noexcept {
 		return this->theData;
 	}
 
@@ -65,6 +65,137 @@ namespace DiscordCoreLoader {
 		this->theData.meanForMemberCount = theDocument["MeanForMemberCount"].get_uint64().take_value();
 		this->theData.stdDeviationForRoleCount = theDocument["StdDeviationForRoleCount"].get_uint64().take_value();
 		this->theData.meanForRoleCount = theDocument["MeanForRoleCount"].get_uint64().take_value();
+		std::string_view theIOBackend{};
+		if (theDocument["IOBackend"].get_string().get(theIOBackend) == simdjson::error_code::SUCCESS && theIOBackend == "io_uring") {
+			this->theData.ioBackend = IOBackend::IoUring;
+		}
+		uint64_t theBusyPollBudgetInUs{};
+		if (theDocument["BusyPollBudgetInUs"].get_uint64().get(theBusyPollBudgetInUs) == simdjson::error_code::SUCCESS) {
+			this->theData.busyPollBudgetInUs = theBusyPollBudgetInUs;
+		}
+		simdjson::ondemand::array theEventRates{};
+		if (theDocument["EventRates"].get_array().get(theEventRates) == simdjson::error_code::SUCCESS) {
+			for (auto value: theEventRates) {
+				simdjson::ondemand::object theObject{};
+				std::string_view theEvent{};
+				if (value.get_object().get(theObject) != simdjson::error_code::SUCCESS ||
+					theObject["Event"].get_string().get(theEvent) != simdjson::error_code::SUCCESS) {
+					continue;
+				}
+				EventRateData theRate{};
+				if (theEvent == "MESSAGE_CREATE") {
+					theRate.theEvent = GatewayEventType::Message_Create;
+				} else if (theEvent == "TYPING_START") {
+					theRate.theEvent = GatewayEventType::Typing_Start;
+				} else {
+					std::cout << shiftToBrightRed() << "Unsupported event type in EventRates: " << theEvent << reset() << std::endl;
+					continue;
+				}
+				std::string_view theArrivals{};
+				if (theObject["Arrivals"].get_string().get(theArrivals) == simdjson::error_code::SUCCESS && theArrivals == "uniform") {
+					theRate.theArrivals = ArrivalProcess::Uniform;
+				}
+				if (double theValue{}; theObject["RatePerSecond"].get_double().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.ratePerSecond = theValue;
+				}
+				theRate.rampToRatePerSecond = theRate.ratePerSecond;
+				if (double theValue{}; theObject["RampToRatePerSecond"].get_double().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.rampToRatePerSecond = theValue;
+				}
+				if (uint64_t theValue{}; theObject["RampDurationInMs"].get_uint64().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.rampDurationInMs = theValue;
+				}
+				if (uint64_t theValue{}; theObject["RampSteps"].get_uint64().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.rampSteps = theValue;
+				}
+				if (uint64_t theValue{}; theObject["BurstSize"].get_uint64().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.burstSize = theValue;
+				}
+				if (uint64_t theValue{}; theObject["BurstPeriodInMs"].get_uint64().get(theValue) == simdjson::error_code::SUCCESS) {
+					theRate.burstPeriodInMs = theValue;
+				}
+				this->theData.eventRates.emplace_back(theRate);
+			}
+		}
+		uint64_t theHandshakeTimeoutInMs{};
+		if (theDocument["HandshakeTimeoutInMs"].get_uint64().get(theHandshakeTimeoutInMs) == simdjson::error_code::SUCCESS) {
+			this->theData.handshakeTimeoutInMs = theHandshakeTimeoutInMs;
+		}
+		uint64_t theHeartbeatIntervalInMs{};
+		if (theDocument["HeartbeatIntervalInMs"].get_uint64().get(theHeartbeatIntervalInMs) == simdjson::error_code::SUCCESS &&
+			theHeartbeatIntervalInMs > 0) {
+			this->theData.heartbeatIntervalInMs = theHeartbeatIntervalInMs;
+		}
+		uint64_t theTlsSessionCacheSize{};
+		if (theDocument["TlsSessionCacheSize"].get_uint64().get(theTlsSessionCacheSize) == simdjson::error_code::SUCCESS) {
+			this->theData.tlsSessionCacheSize = theTlsSessionCacheSize;
+		}
+		std::string_view theTransport{};
+		if (theDocument["Transport"].get_string().get(theTransport) == simdjson::error_code::SUCCESS && theTransport == "plain") {
+			this->theData.transport = TransportType::Plain;
+		}
+		uint64_t theIdentifyValue{};
+		if (theDocument["IdentifyMaxConcurrency"].get_uint64().get(theIdentifyValue) == simdjson::error_code::SUCCESS && theIdentifyValue > 0) {
+			this->theData.identifyMaxConcurrency = theIdentifyValue;
+		}
+		if (theDocument["IdentifyIntervalInMs"].get_uint64().get(theIdentifyValue) == simdjson::error_code::SUCCESS) {
+			this->theData.identifyIntervalInMs = theIdentifyValue;
+		}
+		uint64_t theListenBacklog{};
+		if (theDocument["ListenBacklog"].get_uint64().get(theListenBacklog) == simdjson::error_code::SUCCESS && theListenBacklog > 0) {
+			this->theData.listenBacklog = theListenBacklog;
+		}
+		uint64_t theMaxFrameSizeInBytes{};
+		if (theDocument["MaxFrameSizeInBytes"].get_uint64().get(theMaxFrameSizeInBytes) == simdjson::error_code::SUCCESS &&
+			theMaxFrameSizeInBytes > 0) {
+			this->theData.maxFrameSizeInBytes = theMaxFrameSizeInBytes;
+		}
+		std::string_view theRandomEngine{};
+		if (theDocument["RandomEngine"].get_string().get(theRandomEngine) == simdjson::error_code::SUCCESS && theRandomEngine == "wyrand") {
+			this->theData.randomEngine = RandomEngineType::WyRand;
+		}
+		uint64_t theGuildCorpusDiversity{};
+		if (theDocument["GuildCorpusDiversity"].get_uint64().get(theGuildCorpusDiversity) == simdjson::error_code::SUCCESS &&
+			theGuildCorpusDiversity > 0) {
+			this->theData.guildCorpusDiversity = theGuildCorpusDiversity;
+		}
+		std::string_view theGuildCorpusPath{};
+		if (theDocument["GuildCorpusPath"].get_string().get(theGuildCorpusPath) == simdjson::error_code::SUCCESS) {
+			this->theData.guildCorpusPath = theGuildCorpusPath;
+		}
+		uint64_t theSeed{};
+		if (theDocument["Seed"].get_uint64().get(theSeed) == simdjson::error_code::SUCCESS) {
+			this->theData.seed = theSeed;
+		}
+		bool doWeUseKernelTls{};
+		if (theDocument["UseKernelTls"].get_bool().get(doWeUseKernelTls) == simdjson::error_code::SUCCESS) {
+			this->theData.doWeUseKernelTls = doWeUseKernelTls;
+		}
+		bool doWeUseReusePortListeners{};
+		if (theDocument["UseReusePortListeners"].get_bool().get(doWeUseReusePortListeners) == simdjson::error_code::SUCCESS) {
+			this->theData.doWeUseReusePortListeners = doWeUseReusePortListeners;
+		}
+		bool doWeUseNumaFirstTouch{};
+		if (theDocument["UseNumaFirstTouch"].get_bool().get(doWeUseNumaFirstTouch) == simdjson::error_code::SUCCESS) {
+			this->theData.doWeUseNumaFirstTouch = doWeUseNumaFirstTouch;
+		}
+		bool doWeUseTlsSessionTickets{};
+		if (theDocument["UseTlsSessionTickets"].get_bool().get(doWeUseTlsSessionTickets) == simdjson::error_code::SUCCESS) {
+			this->theData.doWeUseTlsSessionTickets = doWeUseTlsSessionTickets;
+		}
+		uint64_t theWorkerCount{};
+		if (theDocument["WorkerCount"].get_uint64().get(theWorkerCount) == simdjson::error_code::SUCCESS) {
+			this->theData.workerCount = theWorkerCount;
+		}
+		simdjson::ondemand::array theWorkerCpuList{};
+		if (theDocument["WorkerCpuList"].get_array().get(theWorkerCpuList) == simdjson::error_code::SUCCESS) {
+			for (auto value: theWorkerCpuList) {
+				uint64_t theCpu{};
+				if (value.get_uint64().get(theCpu) == simdjson::error_code::SUCCESS) {
+					this->theData.workerCpuList.emplace_back(theCpu);
+				}
+			}
+		}
 	}
 
 }// namespace DiscordCoreLoader
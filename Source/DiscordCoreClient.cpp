@@ -97,88 +97,191 @@ namespace DiscordCoreLoader {
 		this->configParser = ConfigParser{ configFilePath };
 		this->guildQuantity.store(this->configParser.getTheData().guildQuantity);
 		this->jsonifier = this->configParser.getTheData();
+		this->identifyRateLimiter = std::make_unique<IdentifyRateLimiter>(this->configParser.getTheData().identifyMaxConcurrency,
+			this->configParser.getTheData().identifyIntervalInMs);
+		this->guildCorpus = std::make_unique<GuildCorpus>(this->configParser.getTheData());
+		if (this->configParser.getTheData().seed != 0) {
+			std::cout << shiftToBrightGreen() << "Workload seed: " << this->configParser.getTheData().seed << ", corpus digest: " << std::hex
+					  << this->guildCorpus->getDigest() << std::dec << reset() << std::endl;
+		}
+	}
+
+	ShardAcceptor::ShardAcceptor(DiscordCoreClient* discordCoreClientNew, SOCKET theListenerNew, SSL_CTX* theContextNew,
+		bool doWeInstantiateAThread) {
+		this->discordCoreClient = discordCoreClientNew;
+		this->theListener = theListenerNew;
+		if (theContextNew) {
+			SSL_CTX_up_ref(theContextNew);
+		}
+		this->theContext = theContextNew;
+		this->theAgent = std::make_unique<BaseSocketAgent>(this->discordCoreClient->webSocketSSLServerMain.get(), this->discordCoreClient,
+			&Globals::doWeQuit, -1, false);
+		this->isListenerWatched = this->theReactor.registerListener(this->theListener);
+		if (doWeInstantiateAThread) {
+			this->theOwnedListener = theListenerNew;
+			this->theTask = std::make_unique<std::jthread>([this](std::stop_token theToken) {
+				std::stop_callback theStopCallback{ theToken, [this] {
+					this->theReactor.wake();
+				} };
+				while (!theToken.stop_requested() && !Globals::doWeQuit.load()) {
+					this->processShards();
+				}
+			});
+		}
+	}
+
+	void ShardAcceptor::processShards() noexcept {
+		this->acceptNewShards();
+		this->advancePendingShards();
 	}
 
-	void DiscordCoreClient::connectShard() {
+	void ShardAcceptor::acceptNewShards() noexcept {
 		try {
-			while (!this->connectionStopWatch.hasTimePassed()) {
-				std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
-			}
-			if (!this->baseSocketAgentMap.contains(0)) {
-				this->baseSocketAgentMap[0] = std::make_unique<BaseSocketAgent>(this->webSocketSSLServerMain.get(), this, &Globals::doWeQuit, true);
-			}
-			this->connectionStopWatch.resetTimer();
-			auto newShard = std::make_unique<WebSocketSSLShard>(this->webSocketSSLServerMain->getNewSocket(), this->webSocketSSLServerMain->context,
-				this->configParser.getTheData().doWePrintWebSocketErrorMessages, this->baseSocketAgentMap[0].get());
-
-			std::vector<WebSocketSSLShard*> theVector{};
-			theVector.emplace_back(newShard.get());
-			while (newShard->authKey == "") {
-				this->webSocketSSLServerMain->processIO(theVector);
-				this->baseSocketAgentMap[0]->handleBuffer(newShard.get());
-			}
-			newShard->shard[0] = -1;
-			std::string sendString{ "HTTP/1.1 101 Switching Protocols\r\nUpgrade: WebSocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
-				newShard->authKey + "\r\n\r\n" };
-			this->baseSocketAgentMap[0]->sendMessage(&sendString, newShard.get(), false);
-			auto returnValue = this->webSocketSSLServerMain->processIO(theVector);
-			this->baseSocketAgentMap[0]->sendHelloMessage(newShard.get());
-			returnValue = this->webSocketSSLServerMain->processIO(theVector);
-			theVector.clear();
-			theVector.emplace_back(newShard.get());
-			while (newShard->shard[0] == -1) {
-				returnValue = this->webSocketSSLServerMain->processIO(theVector);
-				this->baseSocketAgentMap[0]->handleBuffer(newShard.get());
+			while (!Globals::doWeQuit.load()) {
+				auto theSocket = this->discordCoreClient->webSocketSSLServerMain->getNewSocket(this->theListener);
+				if (theSocket == SOCKET_ERROR) {
+					return;
+				}
+				auto& theConfigData = this->discordCoreClient->configParser.getTheData();
+				auto newShard = std::make_unique<WebSocketSSLShard>(theSocket, this->theContext, theConfigData.transport,
+					theConfigData.doWePrintWebSocketErrorMessages, this->theAgent.get());
+				if (!this->theReactor.registerClient(newShard.get())) {
+					continue;
+				}
+				auto theKey = newShard.get();
+				newShard->theHandshakeTimer.onExpired = [this, theKey] {
+					if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+						std::cout << shiftToBrightRed() << "A connection did not finish its handshake in time, dropping it." << reset() << std::endl
+								  << std::endl;
+					}
+					theKey->disconnect();
+				};
+				this->theTimers.schedule(newShard->theHandshakeTimer, std::chrono::milliseconds{ theConfigData.handshakeTimeoutInMs });
+				this->pendingShards[theKey].theShard = std::move(newShard);
 			}
-			auto theCurrentShard = newShard->shard[0];
-			auto theCurrentBaseSocketAgent = newShard->shard[0] % this->workerCount;
-			if (!this->baseSocketAgentMap.contains(theCurrentBaseSocketAgent)) {
-				this->baseSocketAgentMap[theCurrentBaseSocketAgent] =
-					std::make_unique<BaseSocketAgent>(this->webSocketSSLServerMain.get(), this, &Globals::doWeQuit, true);
+		} catch (...) {
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+				reportException("ShardAcceptor::acceptNewShards()");
 			}
-			if (this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients.contains(theCurrentShard)) {
-				this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->disconnect();
+		}
+	}
+
+	void ShardAcceptor::advancePendingShards() noexcept {
+		try {
+			int32_t theTimeout{ this->isListenerWatched ? ShardAcceptor::maxIdleWaitInMs : 1 };
+			if (auto theTimerTimeout = this->theTimers.getTimeoutInMs(); theTimerTimeout >= 0) {
+				theTimeout = std::min(theTimeout, theTimerTimeout);
 			}
-			this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard] = std::move(newShard);
-
-			this->baseSocketAgentMap[theCurrentBaseSocketAgent]->sendFinalMessage(
-				this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard].get());
-			while (!this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->areWeConnected) {
-				returnValue = this->webSocketSSLServerMain->processIO(theVector);
-				this->baseSocketAgentMap[theCurrentBaseSocketAgent]->handleBuffer(
-					this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard].get());
+			this->theReactor.processIO(theTimeout);
+			this->theTimers.advance();
+			for (auto iterator = this->pendingShards.begin(); iterator != this->pendingShards.end();) {
+				auto& [key, value] = *iterator;
+				if (!value.theShard->areWeStillConnected()) {
+					iterator = this->pendingShards.erase(iterator);
+					continue;
+				}
+				switch (value.theStage) {
+					case AcceptorStage::Upgrading: {
+						if (value.theShard->authKey != "") {
+							value.theShard->shard[0] = -1;
+							std::string sendString{
+								"HTTP/1.1 101 Switching Protocols\r\nUpgrade: WebSocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
+								value.theShard->authKey + "\r\n\r\n"
+							};
+							this->theAgent->sendMessage(&sendString, value.theShard.get(), false);
+							this->theAgent->sendHelloMessage(value.theShard.get());
+							this->theTimers.cancel(value.theShard->theHandshakeTimer);
+							value.theStage = AcceptorStage::Identifying;
+						}
+						++iterator;
+						break;
+					}
+					case AcceptorStage::Identifying: {
+						if (value.theShard->shard[0] != -1 && value.theShard->areWeConnected) {
+							this->handOffShard(value);
+							iterator = this->pendingShards.erase(iterator);
+						} else {
+							++iterator;
+						}
+						break;
+					}
+				}
 			}
-			this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->theAgent =
-				this->baseSocketAgentMap[theCurrentBaseSocketAgent].get();
-			this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->sendGuilds = true;
-			if (this->configParser.getTheData().doWePrintGeneralSuccessMessages) {
-				std::cout << shiftToBrightGreen()
-						  << "Connected Shard " +
-
-						std::to_string(this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->shard[0])
-						  << " of " << this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->shard[1]
-						  << std::string(" Shards for this process. (") +
-						std::to_string(this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->shard[0]) + " of " +
-						std::to_string(this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->shard[1]) +
-						std::string(" Shards total across all processes)")
-						  << reset() << std::endl;
+		} catch (...) {
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+				reportException("ShardAcceptor::advancePendingShards()");
 			}
-			if (this->baseSocketAgentMap[theCurrentBaseSocketAgent]->theClients[theCurrentShard]->shard[0] == this->totalShardCount.load() - 1) {
-				std::cout << shiftToBrightGreen() << "All of the shards are connected for the current process!" << reset() << std::endl << std::endl;
+		}
+	}
+
+	void ShardAcceptor::handOffShard(PendingShard& thePendingShard) noexcept {
+		auto& newShard = thePendingShard.theShard;
+		this->theTimers.cancel(newShard->theHandshakeTimer);
+		auto theBaseSocketAgent = this->discordCoreClient->getBaseSocketAgent(newShard->shard[0] % this->discordCoreClient->workerCount);
+		this->theReactor.unregisterClient(newShard.get());
+		newShard->theAgent = theBaseSocketAgent;
+		newShard->sendGuilds = true;
+		if (this->discordCoreClient->configParser.getTheData().doWePrintGeneralSuccessMessages) {
+			std::cout << shiftToBrightGreen() << "Connected Shard " + std::to_string(newShard->shard[0]) << " of " << newShard->shard[1]
+					  << std::string(" Shards for this process. (") + std::to_string(newShard->shard[0]) + " of " +
+						std::to_string(newShard->shard[1]) + std::string(" Shards total across all processes)");
+			if (newShard->ssl) {
+				auto& theServer = this->discordCoreClient->webSocketSSLServerMain;
+				std::cout << " - TLS handshakes: " << theServer->getFullHandshakeCount() << " full, " << theServer->getResumedHandshakeCount()
+						  << " resumed.";
 			}
-		} catch (...) {
-			if (this->configParser.getTheData().doWePrintWebSocketErrorMessages) {
-				reportException("BaseSocketAgent::connect()");
+			std::cout << reset() << std::endl;
+		}
+		if (newShard->shard[0] == this->discordCoreClient->totalShardCount.load() - 1) {
+			std::cout << shiftToBrightGreen() << "All of the shards are connected for the current process!" << reset() << std::endl << std::endl;
+		}
+		theBaseSocketAgent->addShard(std::move(newShard));
+	}
+
+	ShardAcceptor::~ShardAcceptor() noexcept {
+		if (this->theTask) {
+			this->theTask->request_stop();
+			if (this->theTask->joinable()) {
+				this->theTask->join();
 			}
 		}
 	}
 
+	BaseSocketAgent* DiscordCoreClient::getBaseSocketAgent(int32_t theIndex) {
+		std::lock_guard theLock{ this->theMutex };
+		if (!this->baseSocketAgentMap.contains(theIndex)) {
+			this->baseSocketAgentMap[theIndex] =
+				std::make_unique<BaseSocketAgent>(this->webSocketSSLServerMain.get(), this, &Globals::doWeQuit, theIndex, true);
+		}
+		return this->baseSocketAgentMap[theIndex].get();
+	}
+
+	uint64_t DiscordCoreClient::getConfiguredWorkerCount() noexcept {
+		auto& theConfigData = this->configParser.getTheData();
+		if (theConfigData.workerCount > 0) {
+			return theConfigData.workerCount;
+		} else if (theConfigData.workerCpuList.size() > 0) {
+			return theConfigData.workerCpuList.size();
+		}
+		return std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+	}
+
 	void DiscordCoreClient::runServer() {
 		this->webSocketSSLServerMain = std::make_unique<WebSocketSSLServerMain>(this->configParser.getTheData().connectionIp,
 			this->configParser.getTheData().connectionPort, true, &Globals::doWeQuit, &this->configParser);
+		this->getBaseSocketAgent(0);
+		this->theAcceptors.emplace_back(
+			std::make_unique<ShardAcceptor>(this, this->webSocketSSLServerMain->theServerSocket, this->webSocketSSLServerMain->context, false));
+		if (this->webSocketSSLServerMain->doWeUseReusePort()) {
+			auto theListenerCount = this->getConfiguredWorkerCount();
+			for (uint64_t x = 1; x < theListenerCount; ++x) {
+				if (auto theListener = this->webSocketSSLServerMain->createListeningSocket(); theListener != SOCKET_ERROR) {
+					this->theAcceptors.emplace_back(std::make_unique<ShardAcceptor>(this, theListener, this->webSocketSSLServerMain->context, true));
+				}
+			}
+		}
 		while (!Globals::doWeQuit.load()) {
-			this->connectShard();
-			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+			this->theAcceptors[0]->processShards();
 		}
 		this->baseSocketAgentMap[this->shardingOptions.startingShard]->getTheTask()->join();
 	}
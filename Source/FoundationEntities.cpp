@@ -22,6 +22,7 @@
 #include <discordcoreloader/FoundationEntities.hpp>
 #include <discordcoreloader/SSLClients.hpp>
 #include <discordcoreloader/DataParsingFunctions.hpp>
+#include <discordcoreloader/MonotonicArena.hpp>
 
 namespace DiscordCoreLoader {
 
@@ -730,21 +731,15 @@ namespace DiscordCoreLoader {
 		this->type = typeNew;
 		switch (this->type) {
 			case JsonType::Object: {
-				AllocatorType<ObjectType> allocator{};
-				this->jsonValue.object = AllocatorTraits<ObjectType>::allocate(allocator, 1);
-				AllocatorTraits<ObjectType>::construct(allocator, this->jsonValue.object);
+				this->jsonValue.object = createInArena<ObjectType>();
 				break;
 			}
 			case JsonType::Array: {
-				AllocatorType<ArrayType> allocator{};
-				this->jsonValue.array = AllocatorTraits<ArrayType>::allocate(allocator, 1);
-				AllocatorTraits<ArrayType>::construct(allocator, this->jsonValue.array);
+				this->jsonValue.array = createInArena<ArrayType>();
 				break;
 			}
 			case JsonType::String: {
-				AllocatorType<StringType> allocator{};
-				this->jsonValue.string = AllocatorTraits<StringType>::allocate(allocator, 1);
-				AllocatorTraits<StringType>::construct(allocator, this->jsonValue.string);
+				this->jsonValue.string = createInArena<StringType>();
 				break;
 			}
 		}
@@ -753,21 +748,15 @@ namespace DiscordCoreLoader {
 	void Jsonifier::destroy() noexcept {
 		switch (this->type) {
 			case JsonType::Object: {
-				AllocatorType<ObjectType> allocator{};
-				AllocatorTraits<ObjectType>::destroy(allocator, this->jsonValue.object);
-				AllocatorTraits<ObjectType>::deallocate(allocator, this->jsonValue.object, 1);
+				destroyInArena(this->jsonValue.object);
 				break;
 			}
 			case JsonType::Array: {
-				AllocatorType<ArrayType> allocator{};
-				AllocatorTraits<ArrayType>::destroy(allocator, this->jsonValue.array);
-				AllocatorTraits<ArrayType>::deallocate(allocator, this->jsonValue.array, 1);
+				destroyInArena(this->jsonValue.array);
 				break;
 			}
 			case JsonType::String: {
-				AllocatorType<StringType> allocator{};
-				AllocatorTraits<StringType>::destroy(allocator, this->jsonValue.string);
-				AllocatorTraits<StringType>::deallocate(allocator, this->jsonValue.string, 1);
+				destroyInArena(this->jsonValue.string);
 				break;
 			}
 		}
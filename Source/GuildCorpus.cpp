@@ -0,0 +1,351 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// GuildCorpus.cpp - Source file for the pre-serialized guild corpus.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file GuildCorpus.cpp
+
+#include <discordcoreloader/GuildCorpus.hpp>
+#include <discordcoreloader/WireSerializer.hpp>
+#include <fstream>
+
+#ifdef __linux__
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+namespace DiscordCoreLoader {
+
+	struct GeneratedTemplate {
+		std::vector<uint64_t> theGroupEnds{};
+		std::vector<uint64_t> theOffsets{};
+		uint64_t theInsertOffset{};
+		uint64_t theIdLength{};
+		std::string theBytes{};
+	};
+
+	bool buildTemplate(GeneratedTemplate& theTemplate, const WireDispatch<GuildData>& thePayload, const std::vector<std::string>& theIds,
+		WebSocketMode theMode) {
+		WireIdRecorder theIdRecorder{};
+		theIdRecorder.theOffsets.resize(theIds.size());
+		for (uint64_t x = 0; x < theIds.size(); ++x) {
+			if (theIds[x].size() != Randomizer::idLength) {
+				return false;
+			}
+			theIdRecorder.theGroupIndices.emplace(theIds[x], x);
+		}
+		auto theType = theMode == WebSocketMode::JSON ? JsonifierSerializeType::Json : JsonifierSerializeType::Etf;
+		WireSerializer{ theTemplate.theBytes, theType, &theIdRecorder }.serialize(thePayload);
+		if (!reserveSequenceSlot(theTemplate.theBytes, theType, theTemplate.theInsertOffset)) {
+			return false;
+		}
+
+		for (auto& value: theIdRecorder.theOffsets) {
+			if (value.size() > 0) {
+				theTemplate.theOffsets.insert(theTemplate.theOffsets.end(), value.begin(), value.end());
+				theTemplate.theGroupEnds.emplace_back(theTemplate.theOffsets.size());
+			}
+		}
+		theTemplate.theIdLength = Randomizer::idLength;
+		return true;
+	}
+
+	void appendAligned(std::string& theImage, const void* theData, uint64_t theSize) {
+		theImage.append(static_cast<const char*>(theData), theSize);
+		theImage.resize((theImage.size() + 7) & ~uint64_t{ 7 });
+	}
+
+	bool MappedFile::map(const std::string& thePath) noexcept {
+		this->unmap();
+#ifdef _WIN32
+		HANDLE theFile = CreateFileA(thePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (theFile == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		LARGE_INTEGER theFileSize{};
+		if (!GetFileSizeEx(theFile, &theFileSize) || theFileSize.QuadPart == 0) {
+			CloseHandle(theFile);
+			return false;
+		}
+		HANDLE theMapping = CreateFileMappingA(theFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(theFile);
+		if (theMapping == nullptr) {
+			return false;
+		}
+		auto theAddress = MapViewOfFile(theMapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(theMapping);
+		if (theAddress == nullptr) {
+			return false;
+		}
+		this->theSize = static_cast<uint64_t>(theFileSize.QuadPart);
+#else
+		auto theFile = ::open(thePath.c_str(), O_RDONLY);
+		if (theFile < 0) {
+			return false;
+		}
+		struct stat theStat {};
+		if (fstat(theFile, &theStat) != 0 || theStat.st_size == 0) {
+			::close(theFile);
+			return false;
+		}
+		auto theAddress = mmap(nullptr, static_cast<size_t>(theStat.st_size), PROT_READ, MAP_SHARED, theFile, 0);
+		::close(theFile);
+		if (theAddress == MAP_FAILED) {
+			return false;
+		}
+		this->theSize = static_cast<uint64_t>(theStat.st_size);
+#endif
+		this->theData = static_cast<const char*>(theAddress);
+		return true;
+	}
+
+	const char* MappedFile::data() const noexcept {
+		return this->theData;
+	}
+
+	uint64_t MappedFile::size() const noexcept {
+		return this->theSize;
+	}
+
+	void MappedFile::unmap() noexcept {
+		if (this->theData) {
+#ifdef _WIN32
+			UnmapViewOfFile(this->theData);
+#else
+			munmap(const_cast<char*>(this->theData), this->theSize);
+#endif
+			this->theData = nullptr;
+			this->theSize = 0;
+		}
+	}
+
+	MappedFile::~MappedFile() noexcept {
+		this->unmap();
+	}
+
+	GuildCorpus::GuildCorpus(const ConfigData& configData) {
+		auto theFingerprint = GuildCorpus::getFingerprint(configData);
+		auto theStartTime = std::chrono::steady_clock::now();
+		if (configData.guildCorpusPath != "" && this->theMappedFile.map(configData.guildCorpusPath)) {
+			if (this->parseImage(this->theMappedFile.data(), this->theMappedFile.size(), theFingerprint)) {
+				if (configData.doWePrintGeneralSuccessMessages) {
+					std::cout << shiftToBrightGreen() << "Mapped " << this->size() << " guilds from " << configData.guildCorpusPath << " in "
+							  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - theStartTime).count() << "ms."
+							  << reset() << std::endl;
+				}
+				return;
+			}
+			this->theMappedFile.unmap();
+			if (configData.doWePrintGeneralSuccessMessages) {
+				std::cout << shiftToBrightGreen() << configData.guildCorpusPath << " is stale or damaged, regenerating it." << reset() << std::endl;
+			}
+		}
+		this->generateImage(configData, theFingerprint);
+		if (configData.guildCorpusPath != "" && this->writeImage(configData.guildCorpusPath) && this->theMappedFile.map(configData.guildCorpusPath)) {
+			if (this->parseImage(this->theMappedFile.data(), this->theMappedFile.size(), theFingerprint)) {
+				this->theImage.clear();
+				this->theImage.shrink_to_fit();
+				return;
+			}
+			this->theMappedFile.unmap();
+		}
+		this->parseImage(this->theImage.data(), this->theImage.size(), theFingerprint);
+	}
+
+	const GuildTemplate& GuildCorpus::getTemplate(uint64_t theIndex, WebSocketMode theMode) const noexcept {
+		return this->theTemplates[(theIndex % this->size()) * 2 + (theMode == WebSocketMode::JSON ? 0 : 1)];
+	}
+
+	uint64_t GuildCorpus::getDigest() const noexcept {
+		return this->theDigest;
+	}
+
+	uint64_t GuildCorpus::size() const noexcept {
+		return this->theTemplates.size() / 2;
+	}
+
+	uint64_t GuildCorpus::getFingerprint(const ConfigData& configData) noexcept {
+		uint64_t theValues[]{ GuildCorpus::theVersion, std::max(std::min(configData.guildQuantity, configData.guildCorpusDiversity), uint64_t{ 1 }),
+			configData.seed, static_cast<uint64_t>(configData.randomEngine), configData.meanForStringLength, configData.stdDeviationForStringLength,
+			configData.meanForMemberCount, configData.stdDeviationForMemberCount, configData.meanForChannelCount,
+			configData.stdDeviationForChannelCount, configData.meanForRoleCount, configData.stdDeviationForRoleCount };
+		return digestCorpusBytes(std::string_view{ reinterpret_cast<const char*>(theValues), sizeof(theValues) });
+	}
+
+	bool GuildCorpus::parseImage(const char* theData, uint64_t theSize, uint64_t theFingerprint) noexcept {
+		this->theTemplates.clear();
+		if (theSize < sizeof(CorpusFileHeader)) {
+			return false;
+		}
+		CorpusFileHeader theHeader{};
+		std::memcpy(&theHeader, theData, sizeof(theHeader));
+		if (std::memcmp(theHeader.theMagic, GuildCorpus::theMagic, sizeof(theHeader.theMagic)) != 0 ||
+			theHeader.theVersion != GuildCorpus::theVersion || theHeader.theFingerprint != theFingerprint || theHeader.theSlotCount == 0 ||
+			theHeader.theSlotCount > (theSize - sizeof(CorpusFileHeader)) / (sizeof(CorpusTemplateRecord) * 2)) {
+			return false;
+		}
+		auto isInBounds = [&](uint64_t theOffset, uint64_t theLength, uint64_t theElementSize) {
+			return theOffset % alignof(uint64_t) == 0 && theOffset <= theSize && theLength <= (theSize - theOffset) / theElementSize;
+		};
+		for (uint64_t x = 0; x < theHeader.theSlotCount * 2; ++x) {
+			CorpusTemplateRecord theRecord{};
+			std::memcpy(&theRecord, theData + sizeof(CorpusFileHeader) + x * sizeof(CorpusTemplateRecord), sizeof(theRecord));
+			if (!isInBounds(theRecord.theBytesOffset, theRecord.theBytesLength, 1) ||
+				!isInBounds(theRecord.theOffsetsOffset, theRecord.theOffsetCount, 8) ||
+				!isInBounds(theRecord.theGroupEndsOffset, theRecord.theGroupCount, 8)) {
+				this->theTemplates.clear();
+				return false;
+			}
+			GuildTemplate theTemplate{};
+			theTemplate.theBytes = std::string_view{ theData + theRecord.theBytesOffset, theRecord.theBytesLength };
+			theTemplate.theOffsets = reinterpret_cast<const uint64_t*>(theData + theRecord.theOffsetsOffset);
+			theTemplate.theGroupEnds = reinterpret_cast<const uint64_t*>(theData + theRecord.theGroupEndsOffset);
+			theTemplate.theGroupCount = theRecord.theGroupCount;
+			theTemplate.theInsertOffset = theRecord.theInsertOffset;
+			theTemplate.theIdLength = theRecord.theIdLength;
+			bool isItDamaged = theTemplate.theGroupCount > 0 && theTemplate.theGroupEnds[theTemplate.theGroupCount - 1] > theRecord.theOffsetCount;
+			isItDamaged = isItDamaged || theTemplate.theBytes.size() == 0 || theTemplate.theInsertOffset > theTemplate.theBytes.size();
+			if (isItDamaged || (theTemplate.theGroupCount > 0 && theTemplate.theIdLength != Randomizer::idLength)) {
+				this->theTemplates.clear();
+				return false;
+			}
+			for (uint64_t y = 0; y < theRecord.theOffsetCount; ++y) {
+				if (theTemplate.theOffsets[y] + theTemplate.theIdLength > theTemplate.theBytes.size()) {
+					this->theTemplates.clear();
+					return false;
+				}
+			}
+			this->theTemplates.emplace_back(theTemplate);
+		}
+		this->theDigest = theHeader.theDigest;
+		return true;
+	}
+
+	void GuildCorpus::generateImage(const ConfigData& configData, uint64_t theFingerprint) {
+		auto theGuildCount = std::max(std::min(configData.guildQuantity, configData.guildCorpusDiversity), uint64_t{ 1 });
+		std::vector<GeneratedTemplate> theGeneratedTemplates(theGuildCount * 2);
+		std::atomic_uint64_t theNextIndex{};
+		std::atomic_uint64_t theCompletedCount{};
+		std::atomic_uint64_t theByteCount{};
+		std::atomic_bool didWeFail{ false };
+		auto theStartTime = std::chrono::steady_clock::now();
+		{
+			auto theThreadCount = std::min<uint64_t>(std::max(std::thread::hardware_concurrency(), 1u), theGuildCount);
+			std::vector<std::jthread> theThreads{};
+			for (uint64_t x = 0; x < theThreadCount; ++x) {
+				theThreads.emplace_back([&] {
+					try {
+						JSONIFier theGenerator{ ConfigData{ configData } };
+						for (auto theIndex = theNextIndex.fetch_add(1); theIndex < theGuildCount && !didWeFail.load();
+							 theIndex = theNextIndex.fetch_add(1)) {
+							auto theGuild = theGenerator.generateCorpusGuild(theIndex);
+							theGenerator.seedStream(theIndex, static_cast<uint64_t>(SeedStream::Guild_Template));
+							std::vector<std::string> theIds{};
+							auto assignId = [&](std::string& theValue) {
+								theGenerator.randomizeId(theValue);
+								theIds.emplace_back(theValue);
+							};
+							for (auto& value: theGuild->roles) {
+								assignId(value->id);
+							}
+							for (auto& value: theGuild->members) {
+								assignId(value->user.id);
+							}
+							for (auto& value: theGuild->channels) {
+								assignId(value->id);
+							}
+							assignId(theGuild->id);
+							WireDispatch<GuildData> thePayload{ theGuild.get(), 0, "GUILD_CREATE" };
+							for (auto theMode: { WebSocketMode::JSON, WebSocketMode::ETF }) {
+								auto& theTemplate = theGeneratedTemplates[theIndex * 2 + static_cast<uint64_t>(theMode)];
+								if (!buildTemplate(theTemplate, thePayload, theIds, theMode)) {
+									throw std::runtime_error{ "Failed to build the template of corpus slot " + std::to_string(theIndex) + "." };
+								}
+								theByteCount.fetch_add(theTemplate.theBytes.size());
+							}
+							theCompletedCount.fetch_add(1);
+						}
+					} catch (...) {
+						reportException("GuildCorpus::generateImage()");
+						didWeFail.store(true);
+					}
+				});
+			}
+			while (configData.doWePrintGeneralSuccessMessages && theCompletedCount.load() < theGuildCount && !didWeFail.load()) {
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 250 });
+				std::cout << shiftToBrightGreen() << "Generating the guild corpus: " << theCompletedCount.load() << " of " << theGuildCount
+						  << " guilds..." << reset() << std::endl;
+			}
+		}
+		if (didWeFail.load()) {
+			throw std::runtime_error{ "GuildCorpus::generateImage() Error: The guild corpus is incomplete, so it was neither used nor written." };
+		}
+		if (configData.doWePrintGeneralSuccessMessages) {
+			auto theSeconds = std::max(std::chrono::duration<double>(std::chrono::steady_clock::now() - theStartTime).count(), 1e-9);
+			auto theMegabytes = static_cast<double>(theByteCount.load()) / (1024.0 * 1024.0);
+			std::cout << shiftToBrightGreen() << "Generated " << theCompletedCount.load() << " guilds (" << theMegabytes << " MB of Json and Etf) in "
+					  << theSeconds << "s: " << static_cast<double>(theCompletedCount.load()) / theSeconds << " guilds/s, "
+					  << theMegabytes / theSeconds << " MB/s." << reset() << std::endl;
+		}
+
+		CorpusFileHeader theHeader{};
+		std::memcpy(theHeader.theMagic, GuildCorpus::theMagic, sizeof(theHeader.theMagic));
+		theHeader.theVersion = GuildCorpus::theVersion;
+		theHeader.theFingerprint = theFingerprint;
+		theHeader.theSlotCount = theGuildCount;
+		theHeader.theDigest = digestCorpusBytes("");
+		std::vector<CorpusTemplateRecord> theRecords(theGeneratedTemplates.size());
+		this->theImage.clear();
+		this->theImage.resize(sizeof(CorpusFileHeader) + sizeof(CorpusTemplateRecord) * theRecords.size());
+		for (uint64_t x = 0; x < theGeneratedTemplates.size(); ++x) {
+			auto& theTemplate = theGeneratedTemplates[x];
+			auto& theRecord = theRecords[x];
+			theHeader.theDigest = digestCorpusBytes(theTemplate.theBytes, theHeader.theDigest);
+			theRecord.theBytesOffset = this->theImage.size();
+			theRecord.theBytesLength = theTemplate.theBytes.size();
+			appendAligned(this->theImage, theTemplate.theBytes.data(), theTemplate.theBytes.size());
+			theRecord.theOffsetsOffset = this->theImage.size();
+			theRecord.theOffsetCount = theTemplate.theOffsets.size();
+			appendAligned(this->theImage, theTemplate.theOffsets.data(), theTemplate.theOffsets.size() * sizeof(uint64_t));
+			theRecord.theGroupEndsOffset = this->theImage.size();
+			theRecord.theGroupCount = theTemplate.theGroupEnds.size();
+			appendAligned(this->theImage, theTemplate.theGroupEnds.data(), theTemplate.theGroupEnds.size() * sizeof(uint64_t));
+			theRecord.theInsertOffset = theTemplate.theInsertOffset;
+			theRecord.theIdLength = theTemplate.theIdLength;
+			theTemplate = GeneratedTemplate{};
+		}
+		std::memcpy(this->theImage.data(), &theHeader, sizeof(theHeader));
+		std::memcpy(this->theImage.data() + sizeof(CorpusFileHeader), theRecords.data(), sizeof(CorpusTemplateRecord) * theRecords.size());
+	}
+
+	bool GuildCorpus::writeImage(const std::string& thePath) noexcept {
+		try {
+			auto theTemporaryPath = thePath + ".tmp";
+			{
+				std::ofstream theStream{ theTemporaryPath, std::ios::binary | std::ios::trunc };
+				theStream.write(this->theImage.data(), static_cast<std::streamsize>(this->theImage.size()));
+				if (!theStream.good()) {
+					return false;
+				}
+			}
+			std::filesystem::rename(theTemporaryPath, thePath);
+			return true;
+		} catch (...) {
+			reportException("GuildCorpus::writeImage()");
+			return false;
+		}
+	}
+}
@@ -23,7 +23,7 @@
 
 namespace DiscordCoreLoader {
 
-	JSONIFier& JSONIFier::operator=(ConfigData&& configData) {
+	JSONIFier& JSONIFier::operator=(const ConfigData& configData) {
 		this->stdDeviationForChannelCount = configData.stdDeviationForChannelCount;
 		this->stdDeviationForStringLength = configData.stdDeviationForStringLength;
 		this->stdDeviationForMemberCount = configData.stdDeviationForMemberCount;
@@ -32,11 +32,16 @@ namespace DiscordCoreLoader {
 		this->meanForStringLength = configData.meanForStringLength;
 		this->meanForMemberCount = configData.meanForMemberCount;
 		this->meanForRoleCount = configData.meanForRoleCount;
+		this->setEngineType(configData.randomEngine);
+		this->theSeed = configData.seed;
+		if (this->theSeed != 0) {
+			this->seed(this->theSeed);
+		}
 		return *this;
 	}
 
-	JSONIFier::JSONIFier(ConfigData&& configData) {
-		*this = std::move(configData);
+	JSONIFier::JSONIFier(const ConfigData& configData) {
+		*this = configData;
 	}
 
 	Jsonifier JSONIFier::JSONIFYUnavailableGuild(UnavailableGuild& theGuild) {
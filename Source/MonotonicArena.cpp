@@ -0,0 +1,97 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// MonotonicArena.cpp - Source file for the per-agent monotonic arena.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file MonotonicArena.cpp
+
+#include <discordcoreloader/MonotonicArena.hpp>
+#include <algorithm>
+#include <iostream>
+
+namespace DiscordCoreLoader {
+
+	thread_local MonotonicArena* theCurrentArena{ nullptr };
+
+	MonotonicArena::MonotonicArena(uint64_t theBlockSizeNew) noexcept {
+		this->theBlockSize = std::max(theBlockSizeNew, uint64_t{ 64 });
+	}
+
+	void* MonotonicArena::allocate(uint64_t theSize, uint64_t theAlignment) {
+		if (this->theBlocks.size() > 0) {
+			auto& theBlock = this->theBlocks.back();
+			auto theStart = (reinterpret_cast<uintptr_t>(theBlock.theData.get()) + this->theOffset + theAlignment - 1) & ~(theAlignment - 1);
+			auto theEnd = theStart + theSize;
+			if (theEnd <= reinterpret_cast<uintptr_t>(theBlock.theData.get()) + theBlock.theSize) {
+				this->theOffset = theEnd - reinterpret_cast<uintptr_t>(theBlock.theData.get());
+				return reinterpret_cast<void*>(theStart);
+			}
+		}
+		this->addBlock(theSize + theAlignment);
+		auto& theBlock = this->theBlocks.back();
+		auto theStart = (reinterpret_cast<uintptr_t>(theBlock.theData.get()) + theAlignment - 1) & ~(theAlignment - 1);
+		this->theOffset = theStart + theSize - reinterpret_cast<uintptr_t>(theBlock.theData.get());
+		return reinterpret_cast<void*>(theStart);
+	}
+
+	void MonotonicArena::release() noexcept {
+#ifndef NDEBUG
+		if (this->theLiveObjectCount != 0) {
+			std::cerr << this->theLiveObjectCount << " object(s) allocated in a MonotonicArena outlived their ArenaScope." << std::endl;
+			std::abort();
+		}
+#endif
+		if (this->theBlocks.size() > 1) {
+			auto theLargest = std::max_element(this->theBlocks.begin(), this->theBlocks.end(), [](const Block& lhs, const Block& rhs) {
+				return lhs.theSize < rhs.theSize;
+			});
+			auto theBlock = std::move(*theLargest);
+			this->theBlocks.clear();
+			this->theBlocks.emplace_back(std::move(theBlock));
+		}
+		this->theOffset = 0;
+	}
+
+	void MonotonicArena::trackObjects(int64_t theDelta) noexcept {
+		this->theLiveObjectCount += theDelta;
+	}
+
+	MonotonicArena* MonotonicArena::current() noexcept {
+		return theCurrentArena;
+	}
+
+	void MonotonicArena::addBlock(uint64_t theMinimumSize) {
+		Block theBlock{};
+		theBlock.theSize = std::max(this->theBlockSize, theMinimumSize);
+		theBlock.theData = std::make_unique_for_overwrite<char[]>(theBlock.theSize);
+		this->theBlocks.emplace_back(std::move(theBlock));
+		this->theOffset = 0;
+	}
+
+	ArenaScope::ArenaScope(MonotonicArena& theArenaNew) noexcept {
+		this->thePreviousArena = theCurrentArena;
+		this->theArena = &theArenaNew;
+		theCurrentArena = this->theArena;
+	}
+
+	ArenaScope::~ArenaScope() noexcept {
+		theCurrentArena = this->thePreviousArena;
+		if (this->thePreviousArena != this->theArena) {
+			this->theArena->release();
+		}
+	}
+
+}
@@ -24,13 +24,26 @@
 
 namespace DiscordCoreLoader {
 
+	void ObjectGenerator::seedStream(uint64_t theKey, uint64_t theStream) noexcept {
+		if (this->theSeed != 0) {
+			this->seed(Randomizer::deriveSeed(Randomizer::deriveSeed(this->theSeed, theKey), theStream));
+		}
+	}
+
+	std::string ObjectGenerator::generateTimestamp() {
+		if (this->theSeed != 0) {
+			return convertTimeInMsToDateTimeString(ObjectGenerator::fixedTimestampInMs, TimeFormat::LongDateTime);
+		}
+		return convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
+	}
+
 	std::unique_ptr<GuildMemberData> ObjectGenerator::generateGuildMember(const std::string& guildId,
 		const std::vector<std::unique_ptr<RoleData>>& roles) {
 		std::unique_ptr<GuildMemberData> theData{ std::make_unique<GuildMemberData>() };
 		theData->nick = this->randomizeString(
 			this->randomize64BitUInt(static_cast<double>(this->meanForStringLength), static_cast<double>(this->stdDeviationForStringLength)));
-		theData->communicationDisabledUntil = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
-		theData->premiumSince = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
+		theData->communicationDisabledUntil = this->generateTimestamp();
+		theData->premiumSince = this->generateTimestamp();
 		theData->joinedAt = "";
 		int8_t theAmount = this->randomize8BitInt(0, static_cast<uint8_t>(roles.size()));
 		theData->permissions = std::to_string(this->randomize64BitUInt());
@@ -63,9 +76,9 @@ namespace DiscordCoreLoader {
 		theData->topic = this->randomizeString(
 			this->randomize64BitUInt(static_cast<double>(this->meanForStringLength), static_cast<double>(this->stdDeviationForStringLength)));
 		theData->permissions = std::to_string(this->randomize64BitUInt());
-		theData->threadMetadata.archiveTimestamp = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
-		theData->member.joinTimestamp = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
-		theData->lastPinTimestamp = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
+		theData->threadMetadata.archiveTimestamp = this->generateTimestamp();
+		theData->member.joinTimestamp = this->generateTimestamp();
+		theData->lastPinTimestamp = this->generateTimestamp();
 		theData->defaultAutoArchiveDuration = static_cast<int32_t>(this->randomize8BitInt());
 		for (int32_t x = 0; x < this->randomize8BitInt(0, 25); x++) {
 			OverWriteData theDataNew{};
@@ -189,7 +202,7 @@ namespace DiscordCoreLoader {
 			theDataNew.guildId = guildId;
 			theDataNew.member = *theData->members[this->randomize8BitUInt(0, static_cast<uint8_t>(theData->members.size() - 2))];
 			theDataNew.mute = true;
-			theDataNew.requestToSpeakTimestamp = convertTimeInMsToDateTimeString(time(nullptr), TimeFormat::LongDateTime);
+			theDataNew.requestToSpeakTimestamp = this->generateTimestamp();
 			theDataNew.selfDeaf = true;
 			theDataNew.selfMute = true;
 			theDataNew.selfStream = false;
@@ -208,6 +221,13 @@ namespace DiscordCoreLoader {
 		return theData;
 	}
 
+	std::unique_ptr<GuildData> ObjectGenerator::generateCorpusGuild(uint64_t theIndex) {
+		this->seedStream(theIndex, static_cast<uint64_t>(SeedStream::Guild_Data));
+		std::string theGuildId{};
+		this->randomizeId(theGuildId);
+		return this->generateGuild(theGuildId);
+	}
+
 	std::unique_ptr<RoleData> ObjectGenerator::generateRole(uint64_t position) {
 		std::unique_ptr<RoleData> theData{ std::make_unique<RoleData>() };
 		theData->name = this->randomizeString(
@@ -229,6 +249,11 @@ namespace DiscordCoreLoader {
 		return theData;
 	}
 
+	std::string ObjectGenerator::generateContent() {
+		return this->randomizeString(
+			this->randomize64BitUInt(static_cast<double>(this->meanForStringLength), static_cast<double>(this->stdDeviationForStringLength)));
+	}
+
 	std::unique_ptr<UserData> ObjectGenerator::generateUser() {
 		std::unique_ptr<UserData> theData{ std::make_unique<UserData>() };
 		theData->userName = this->randomizeString(
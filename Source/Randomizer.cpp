@@ -20,9 +20,137 @@
 /// \file Randomizer.cpp
 
 #include <discordcoreloader/Randomizer.hpp>
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
 
 namespace DiscordCoreLoader {
 
+	inline uint64_t multiply64To128(uint64_t lhs, uint64_t rhs, uint64_t& theHigh) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _umul128(lhs, rhs, &theHigh);
+#else
+		auto theResult = static_cast<unsigned __int128>(lhs) * rhs;
+		theHigh = static_cast<uint64_t>(theResult >> 64);
+		return static_cast<uint64_t>(theResult);
+#endif
+	}
+
+	inline uint64_t splitMix64(uint64_t& theState) noexcept {
+		uint64_t theValue = (theState += 0x9e3779b97f4a7c15ull);
+		theValue = (theValue ^ (theValue >> 30)) * 0xbf58476d1ce4e5b9ull;
+		theValue = (theValue ^ (theValue >> 27)) * 0x94d049bb133111ebull;
+		return theValue ^ (theValue >> 31);
+	}
+
+	RandomEngine::RandomEngine(RandomEngineType theTypeNew, uint64_t theSeed) noexcept {
+		this->theType = theTypeNew;
+		this->seed(theSeed);
+	}
+
+	void RandomEngine::seed(uint64_t theSeed) noexcept {
+		for (auto& value: this->theState) {
+			value = splitMix64(theSeed);
+		}
+	}
+
+	RandomEngine::result_type RandomEngine::operator()() noexcept {
+		switch (this->theType) {
+			case RandomEngineType::WyRand: {
+				this->theState[0] += 0xa0761d6478bd642full;
+				uint64_t theHigh{};
+				auto theLow = multiply64To128(this->theState[0], this->theState[0] ^ 0xe7037ed1a0b428dbull, theHigh);
+				return theHigh ^ theLow;
+			}
+			default: {
+				const uint64_t theResult = std::rotl(this->theState[1] * 5, 7) * 9;
+				const uint64_t theShifted = this->theState[1] << 17;
+				this->theState[2] ^= this->theState[0];
+				this->theState[3] ^= this->theState[1];
+				this->theState[1] ^= this->theState[2];
+				this->theState[0] ^= this->theState[3];
+				this->theState[2] ^= theShifted;
+				this->theState[3] = std::rotl(this->theState[3], 45);
+				return theResult;
+			}
+		}
+	}
+
+	Randomizer::Randomizer() noexcept {
+		std::random_device randomDevice{};
+		this->randomEngine.seed((static_cast<uint64_t>(randomDevice()) << 32) | randomDevice());
+	}
+
+	void Randomizer::setEngineType(RandomEngineType theType) noexcept {
+		this->randomEngine = RandomEngine{ theType, this->randomEngine() };
+		this->currentNormalIndex = Randomizer::normalCacheSize;
+	}
+
+	void Randomizer::seed(uint64_t theSeed) noexcept {
+		this->randomEngine.seed(theSeed);
+		this->currentNormalIndex = Randomizer::normalCacheSize;
+	}
+
+	uint64_t Randomizer::deriveSeed(uint64_t theSeed, uint64_t theStream) noexcept {
+		uint64_t theState = theSeed ^ (theStream * 0xd1b54a32d192ed03ull);
+		return splitMix64(theState);
+	}
+
+	uint64_t Randomizer::randomizeBounded(uint64_t theRange) noexcept {
+		uint64_t theHigh{};
+		uint64_t theLow = multiply64To128(this->randomEngine(), theRange, theHigh);
+		if (theLow < theRange) {
+			const uint64_t theThreshold = (0 - theRange) % theRange;
+			while (theLow < theThreshold) {
+				theLow = multiply64To128(this->randomEngine(), theRange, theHigh);
+			}
+		}
+		return theHigh;
+	}
+
+	double Randomizer::randomizeUnitInterval() noexcept {
+		return static_cast<double>(this->randomEngine() >> 11) * 0x1.0p-53;
+	}
+
+	void Randomizer::fillBounded64BitUInts(uint64_t* theValues, uint64_t theCount, uint64_t minValue, uint64_t maxValue) noexcept {
+		if (maxValue <= minValue) {
+			std::fill(theValues, theValues + theCount, minValue);
+			return;
+		}
+		const uint64_t theRange = maxValue - minValue;
+		for (uint64_t x = 0; x < theCount; ++x) {
+			theValues[x] = theRange == UINT64_MAX ? this->randomEngine() : minValue + this->randomizeBounded(theRange + 1);
+		}
+	}
+
+	void Randomizer::fillNormals(double* theValues, uint64_t theCount, double mean, double stdDeviation) noexcept {
+		static constexpr uint64_t theBlockSize{ 64 };
+		std::array<double, theBlockSize> theRadii{};
+		std::array<double, theBlockSize> theAngles{};
+		for (uint64_t x = 0; x < theCount; x += theBlockSize * 2) {
+			for (uint64_t y = 0; y < theBlockSize; ++y) {
+				theRadii[y] = 1.0 - this->randomizeUnitInterval();
+				theAngles[y] = this->randomizeUnitInterval();
+			}
+			for (uint64_t y = 0; y < theBlockSize; ++y) {
+				theRadii[y] = std::sqrt(-2.0 * std::log(theRadii[y])) * stdDeviation;
+				theAngles[y] *= 2.0 * std::numbers::pi;
+			}
+			for (uint64_t y = 0; y < theBlockSize && x + y * 2 < theCount; ++y) {
+				theValues[x + y * 2] = mean + theRadii[y] * std::cos(theAngles[y]);
+				if (x + y * 2 + 1 < theCount) {
+					theValues[x + y * 2 + 1] = mean + theRadii[y] * std::sin(theAngles[y]);
+				}
+			}
+		}
+	}
+
+	void Randomizer::fillIds(std::string* theIds, uint64_t theCount, uint64_t minValue, uint64_t maxValue) {
+		for (uint64_t x = 0; x < theCount; ++x) {
+			this->randomizeId(theIds[x], minValue, maxValue);
+		}
+	}
+
 	template<typename ReturnType> std::string toHex(ReturnType inputValue) {
 		std::stringstream theStream{};
 		theStream << std::setfill('0') << std::setw(sizeof(ReturnType) * 2) << std::hex << inputValue;
@@ -52,8 +180,7 @@ namespace DiscordCoreLoader {
 	std::string Randomizer::randomizeString(int64_t length) {
 		std::string returnString{};
 		for (uint32_t x = 0; x < length; x++) {
-			auto theValue =
-				static_cast<char>((static_cast<float>(this->randomEngine()) / static_cast<float>(this->randomEngine.max()) * 93.0f) + 35.0f);
+			auto theValue = static_cast<char>(this->randomizeBounded(93) + 35);
 			if (static_cast<char>(theValue) == static_cast<char>(',') || static_cast<char>(theValue) == '\'' || static_cast<char>(theValue) == '/' ||
 				static_cast<char>(theValue) == '\"' || static_cast<char>(theValue) == '\\' || static_cast<char>(theValue) == '`' ||
 				static_cast<char>(theValue) == '{' || static_cast<char>(theValue) == '}' || static_cast<char>(theValue) == '[' ||
@@ -71,8 +198,8 @@ namespace DiscordCoreLoader {
 		returnString.resize(20);
 		auto theValue = this->randomize64BitUInt(minValue, maxValue);
 		std::to_chars(returnString.data(), returnString.data() + returnString.size(), theValue);
-		if (returnString.size() > 18) {
-			uint64_t length = returnString.size() - 18;
+		if (returnString.size() > Randomizer::idLength) {
+			uint64_t length = returnString.size() - Randomizer::idLength;
 			theString = std::move(returnString.substr(0, returnString.size() - length));
 			for (int32_t x = 0; x < theString.size(); ++x) {
 				if (static_cast<char>(theString[x]) == static_cast<char>(',') || static_cast<char>(theString[x]) == '\'' ||
@@ -87,9 +214,16 @@ namespace DiscordCoreLoader {
 		}
 	}
 
+	double Randomizer::randomizeExponential(double theRate) noexcept {
+		return -std::log1p(-this->randomizeUnitInterval()) / theRate;
+	}
+
 	uint64_t Randomizer::randomize64BitUInt(double mean, double stdDeviation) {
-		std::normal_distribution<> normalDistributionTwo{ mean, stdDeviation };
-		auto theResult = normalDistributionTwo(this->randomEngine);
+		if (this->currentNormalIndex >= Randomizer::normalCacheSize) {
+			this->fillNormals(this->theNormals.data(), Randomizer::normalCacheSize, 0.0, 1.0);
+			this->currentNormalIndex = 0;
+		}
+		auto theResult = mean + this->theNormals[this->currentNormalIndex++] * stdDeviation;
 		if (theResult < 0) {
 			theResult = -theResult;
 		}
@@ -97,47 +231,41 @@ namespace DiscordCoreLoader {
 	}
 
 	uint64_t Randomizer::randomize64BitUInt(uint64_t minValue, uint64_t maxValue) {
-		double difference = maxValue - minValue;
-		uint64_t theValue =
-			static_cast<uint64_t>(static_cast<double>(this->randomEngine()) / static_cast<double>(this->randomEngine.max()) * difference) + minValue;
+		uint64_t theValue{};
+		this->fillBounded64BitUInts(&theValue, 1, minValue, maxValue);
 		return theValue;
 	}
 
 	uint32_t Randomizer::randomize32BitUInt(uint32_t minValue, uint32_t maxValue) {
-		double difference = maxValue - minValue;
-		uint32_t theValue =
-			static_cast<uint32_t>(static_cast<double>(this->randomEngine()) / static_cast<double>(this->randomEngine.max()) * difference) + minValue;
-		return theValue;
+		if (maxValue <= minValue) {
+			return minValue;
+		}
+		return static_cast<uint32_t>(minValue + this->randomizeBounded(static_cast<uint64_t>(maxValue - minValue) + 1));
 	}
 
 	uint16_t Randomizer::randomize16BitUInt(uint16_t minValue, uint16_t maxValue) {
-		double difference = maxValue - minValue;
-		uint16_t theValue =
-			static_cast<uint16_t>(static_cast<double>(this->randomEngine()) / static_cast<double>(this->randomEngine.max()) * difference) + minValue;
-		return theValue;
+		if (maxValue <= minValue) {
+			return minValue;
+		}
+		return static_cast<uint16_t>(minValue + this->randomizeBounded(static_cast<uint64_t>(maxValue - minValue) + 1));
 	}
 
 	uint8_t Randomizer::randomize8BitUInt(uint8_t minValue, uint8_t maxValue) {
-		double difference = maxValue - minValue;
-		uint8_t theValue =
-			static_cast<uint8_t>(static_cast<double>(this->randomEngine()) / static_cast<double>(this->randomEngine.max()) * difference) + minValue;
-		return theValue;
+		if (maxValue <= minValue) {
+			return minValue;
+		}
+		return static_cast<uint8_t>(minValue + this->randomizeBounded(static_cast<uint64_t>(maxValue - minValue) + 1));
 	}
 
 	int8_t Randomizer::randomize8BitInt(uint8_t minValue, uint8_t maxValue) {
-		double difference = maxValue - minValue;
-		int8_t theValue =
-			static_cast<int8_t>(static_cast<double>(this->randomEngine()) / static_cast<double>(this->randomEngine.max()) * difference) + minValue;
-		return theValue;
+		return static_cast<int8_t>(this->randomize8BitUInt(minValue, maxValue));
 	}
 
 	uint64_t Randomizer::drawRandomValue(std::vector<uint64_t>& theValues) {
 		if (theValues.size() == 0) {
 			return 0;
 		}
-		uint32_t valueIndex = static_cast<uint32_t>(
-			(static_cast<float>(this->randomEngine()) / static_cast<float>(this->randomEngine.max())) * static_cast<float>(theValues.size()));
-		return theValues[valueIndex];
+		return theValues[this->randomizeBounded(theValues.size())];
 	}
 
 	uint64_t Randomizer::randomize64BitUInt() {
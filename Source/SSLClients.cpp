@@ -115,6 +115,23 @@ namespace DiscordCoreLoader {
 		return this->ptr.get();
 	}
 
+	void BIOWrapper::BIODeleter::operator()(BIO* other) {
+		if (other) {
+			BIO_free(other);
+			other = nullptr;
+		}
+	}
+
+	BIOWrapper& BIOWrapper::operator=(BIO* other) {
+		this->ptr.reset(nullptr);
+		this->ptr = std::unique_ptr<BIO, BIODeleter>(other, BIODeleter{});
+		return *this;
+	}
+
+	BIOWrapper::operator BIO*() {
+		return this->ptr.get();
+	}
+
 	void SOCKETWrapper::SOCKETDeleter::operator()(SOCKET* other) {
 		if (*other != SOCKET_ERROR) {
 #ifdef _WIN32
@@ -192,6 +209,171 @@ namespace DiscordCoreLoader {
 		}
 	}
 
+	RingBuffer::RingBuffer(uint64_t theCapacityNew) noexcept {
+		this->theCapacity = theCapacityNew;
+		this->theBuffer = std::make_unique<char[]>(this->theCapacity + simdjson::SIMDJSON_PADDING);
+	}
+
+	char* RingBuffer::getWritePointer(uint64_t theSize) noexcept {
+		if (this->theCapacity - this->theWriteIndex < theSize) {
+			auto theLiveSize = this->size();
+			if (this->theCapacity - theLiveSize < theSize) {
+				auto theCapacityNew = std::max(this->theCapacity * 2, theLiveSize + theSize);
+				auto theBufferNew = std::make_unique<char[]>(theCapacityNew + simdjson::SIMDJSON_PADDING);
+				std::memcpy(theBufferNew.get(), this->data(), theLiveSize);
+				this->theBuffer = std::move(theBufferNew);
+				this->theCapacity = theCapacityNew;
+			} else {
+				std::memmove(this->theBuffer.get(), this->data(), theLiveSize);
+			}
+			this->theReadIndex = 0;
+			this->theWriteIndex = theLiveSize;
+		}
+		return this->theBuffer.get() + this->theWriteIndex;
+	}
+
+	void RingBuffer::commitWrite(uint64_t theSize) noexcept {
+		this->theWriteIndex += theSize;
+	}
+
+	void RingBuffer::consume(uint64_t theSize) noexcept {
+		this->theReadIndex += std::min(theSize, this->size());
+		if (this->theReadIndex == this->theWriteIndex) {
+			this->theReadIndex = 0;
+			this->theWriteIndex = 0;
+		}
+	}
+
+	uint64_t RingBuffer::getPaddedSize() noexcept {
+		return this->theCapacity + simdjson::SIMDJSON_PADDING - this->theReadIndex;
+	}
+
+	std::string_view RingBuffer::getView() noexcept {
+		return std::string_view{ this->data(), this->size() };
+	}
+
+	uint64_t RingBuffer::size() noexcept {
+		return this->theWriteIndex - this->theReadIndex;
+	}
+
+	char* RingBuffer::data() noexcept {
+		return this->theBuffer.get() + this->theReadIndex;
+	}
+
+	void RingBuffer::clear() noexcept {
+		this->theReadIndex = 0;
+		this->theWriteIndex = 0;
+	}
+
+	void RingBuffer::rehome() noexcept {
+		auto theLiveSize = this->size();
+		auto theBufferNew = std::make_unique<char[]>(this->theCapacity + simdjson::SIMDJSON_PADDING);
+		std::memcpy(theBufferNew.get(), this->data(), theLiveSize);
+		this->theBuffer = std::move(theBufferNew);
+		this->theReadIndex = 0;
+		this->theWriteIndex = theLiveSize;
+	}
+
+	void OutputChain::append(const char* theData, uint64_t theSize) {
+		while (theSize > 0) {
+			if (this->theChunks.size() == 0 || this->theChunks.back().isSealed || this->theChunks.back().theSize == OutputChain::theChunkSize) {
+				Chunk theChunk{};
+				if (this->theFreeChunks.size() > 0) {
+					theChunk.theData = std::move(this->theFreeChunks.back());
+					this->theFreeChunks.pop_back();
+				} else {
+					theChunk.theData = std::make_unique_for_overwrite<char[]>(OutputChain::theChunkSize);
+				}
+				this->theChunks.emplace_back(std::move(theChunk));
+			}
+			auto& theChunk = this->theChunks.back();
+			auto theAmount = std::min(theSize, OutputChain::theChunkSize - theChunk.theSize);
+			std::memcpy(theChunk.theData.get() + theChunk.theSize, theData, theAmount);
+			theChunk.theSize += theAmount;
+			theData += theAmount;
+			theSize -= theAmount;
+		}
+	}
+
+	void OutputChain::markFrame() noexcept {
+		if (this->theChunks.size() == 0 || this->theChunks.back().isSealed || this->theChunks.back().theSize == OutputChain::theChunkSize) {
+			this->theMarkChunk = this->theChunks.size();
+			this->theMarkOffset = 0;
+		} else {
+			this->theMarkChunk = this->theChunks.size() - 1;
+			this->theMarkOffset = this->theChunks.back().theSize;
+		}
+	}
+
+	void OutputChain::patch(uint64_t thePosition, const char* theData, uint64_t theSize) noexcept {
+		auto theIndex = this->theMarkChunk + (this->theMarkOffset + thePosition) / OutputChain::theChunkSize;
+		auto theOffset = (this->theMarkOffset + thePosition) % OutputChain::theChunkSize;
+		while (theSize > 0 && theIndex < this->theChunks.size()) {
+			auto theAmount = std::min(theSize, OutputChain::theChunkSize - theOffset);
+			std::memcpy(this->theChunks[theIndex].theData.get() + theOffset, theData, theAmount);
+			theData += theAmount;
+			theSize -= theAmount;
+			theOffset = 0;
+			++theIndex;
+		}
+	}
+
+	std::string_view OutputChain::front() noexcept {
+		if (this->theChunks.size() == 0) {
+			return {};
+		}
+		auto& theChunk = this->theChunks.front();
+		theChunk.isSealed = true;
+		return std::string_view{ theChunk.theData.get() + this->theFrontOffset, theChunk.theSize - this->theFrontOffset };
+	}
+
+	void OutputChain::consume(uint64_t theSize) noexcept {
+		while (theSize > 0 && this->theChunks.size() > 0) {
+			auto theAmount = std::min(theSize, this->theChunks.front().theSize - this->theFrontOffset);
+			this->theFrontOffset += theAmount;
+			theSize -= theAmount;
+			if (this->theFrontOffset == this->theChunks.front().theSize) {
+				this->popFront();
+			}
+		}
+	}
+
+	void OutputChain::popFront() noexcept {
+		if (this->theChunks.size() > 0) {
+			if (this->theFreeChunks.size() < OutputChain::theMaxFreeChunks) {
+				this->theFreeChunks.emplace_back(std::move(this->theChunks.front().theData));
+			}
+			this->theChunks.pop_front();
+			this->theFrontOffset = 0;
+		}
+	}
+
+#ifdef __linux__
+	uint64_t OutputChain::gather(iovec* theVectors, uint64_t theMaxCount) noexcept {
+		uint64_t theCount{};
+		for (; theCount < theMaxCount && theCount < this->theChunks.size(); ++theCount) {
+			auto theOffset = theCount == 0 ? this->theFrontOffset : 0;
+			theVectors[theCount].iov_base = this->theChunks[theCount].theData.get() + theOffset;
+			theVectors[theCount].iov_len = this->theChunks[theCount].theSize - theOffset;
+		}
+		return theCount;
+	}
+#endif
+
+	uint64_t OutputChain::size() noexcept {
+		return this->theChunks.size();
+	}
+
+	void OutputChain::clear() noexcept {
+		while (this->theChunks.size() > 0) {
+			this->popFront();
+		}
+	}
+
+	void OutputChain::releaseFreeChunks() noexcept {
+		this->theFreeChunks.clear();
+	}
+
 	SSLClient& SSLClient::operator=(SSLClient&& other) noexcept {
 		if (this != &other) {
 			this->serverToClientBuffer = std::move(other.serverToClientBuffer);
@@ -199,12 +381,14 @@ namespace DiscordCoreLoader {
 			this->currentReconnectTries = other.currentReconnectTries;
 			this->theMessageQueue = std::move(other.theMessageQueue);
 			this->currentSocketIndex = other.currentSocketIndex;
-			this->outputBuffers = std::move(other.outputBuffers);
+			this->outputChain = std::move(other.outputChain);
 			this->clientSocket = std::move(other.clientSocket);
 			this->currentGuildCount = other.currentGuildCount;
 			this->inputBuffer = std::move(other.inputBuffer);
 			this->theContext = std::move(other.theContext);
 			this->totalGuildCount = other.totalGuildCount;
+			this->isHandshakeComplete = other.isHandshakeComplete;
+			this->doesHandshakeWantWrite = other.doesHandshakeWantWrite;
 			this->areWeConnected = other.areWeConnected;
 			this->doWePrintError = other.doWePrintError;
 			this->lastNumberSent = other.lastNumberSent;
@@ -214,6 +398,9 @@ namespace DiscordCoreLoader {
 			this->sendGuilds = other.sendGuilds;
 			this->bytesRead = other.bytesRead;
 			this->ssl = std::move(other.ssl);
+			this->theTransport = other.theTransport;
+			this->plainWriteBio = std::move(other.plainWriteBio);
+			this->plainBio = std::move(other.plainBio);
 			this->theState = other.theState;
 			this->shard[0] = other.shard[0];
 			this->shard[1] = other.shard[1];
@@ -225,13 +412,23 @@ namespace DiscordCoreLoader {
 		*this = std::move(other);
 	}
 
-	SSLClient::SSLClient(SOCKET theSocket, SSL_CTX* theContextNew, bool doWePrintErrorsNew) : maxBufferSize(1024 * 16) {
+	SSLClient::SSLClient(SOCKET theSocket, SSL_CTX* theContextNew, TransportType theTransportNew, bool doWePrintErrorsNew)
+		: maxBufferSize(1024 * 16) {
 		this->serverToClientBuffer.resize(this->maxBufferSize);
 		this->doWePrintError = doWePrintErrorsNew;
+		this->theTransport = theTransportNew;
 		this->theContext = theContextNew;
 		this->clientSocket = theSocket;
 
-		if (this->clientSocket != SOCKET_ERROR) {
+		if (this->clientSocket != SOCKET_ERROR && this->theTransport == TransportType::Plain) {
+			if (this->plainBio = BIO_new_socket(static_cast<int32_t>(this->clientSocket), BIO_NOCLOSE); this->plainBio == nullptr) {
+				if (this->doWePrintError) {
+					std::cout << reportSSLError("BIO_new_socket() Error: ");
+				}
+				return;
+			}
+			this->isHandshakeComplete = true;
+		} else if (this->clientSocket != SOCKET_ERROR) {
 			if (this->ssl = SSL_new(this->theContext); this->ssl == nullptr) {
 				if (this->doWePrintError) {
 					std::cout << reportSSLError("SSL_new() Error: ");
@@ -239,6 +436,8 @@ namespace DiscordCoreLoader {
 				return;
 			}
 
+			SSL_set_mode(this->ssl, SSL_MODE_ENABLE_PARTIAL_WRITE);
+
 			if (!SSL_set_min_proto_version(this->ssl, TLS1_2_VERSION)) {
 				if (this->doWePrintError) {
 					std::cout << reportSSLError("SSL_set_min_proto_version() Error: ");
@@ -253,58 +452,28 @@ namespace DiscordCoreLoader {
 				return;
 			}
 
-			while (SSL_accept(this->ssl) != 1) {
-				std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
-			}
-
-			this->areWeConnected = true;
+			SSL_set_accept_state(this->ssl);
 		}
 	};
 
 	void SSLClient::writeData(std::string& dataToWrite, bool priority) noexcept {
-		if (dataToWrite.size() > 0 && this->ssl) {
-			if (priority && dataToWrite.size() < static_cast<size_t>(16 * 1024)) {
-				pollfd readWriteSet{};
-				readWriteSet.fd = this->clientSocket;
-				readWriteSet.events = POLLOUT;
-				if (auto returnValue = poll(&readWriteSet, 1, 1); returnValue == SOCKET_ERROR) {
-					this->disconnect();
-					return;
-				} else if (returnValue == 0) {
-					return;
-				}
-
-				if (readWriteSet.revents & POLLOUT) {
-					this->outputBuffers.emplace_back(dataToWrite);
-					if (!this->writeDataProcess()) {
-						return;
-					}
-				}
+		if (dataToWrite.size() > 0 && this->hasTransport()) {
+			try {
+				this->outputChain.append(dataToWrite.data(), dataToWrite.size());
+			} catch (...) {
+				reportException("SSLClient::writeData()");
+				return;
+			}
+			if (priority && dataToWrite.size() < OutputChain::theChunkSize) {
+				this->writeDataProcess();
 			} else {
-				if (dataToWrite.size() >= static_cast<size_t>(16 * 1024)) {
-					size_t remainingBytes{ dataToWrite.size() };
-					while (remainingBytes > 0) {
-						std::string newString{};
-						size_t amountToCollect{};
-						if (dataToWrite.size() >= static_cast<size_t>(1024 * 16)) {
-							amountToCollect = static_cast<size_t>(1024 * 16);
-						} else {
-							amountToCollect = dataToWrite.size();
-						}
-						newString.insert(newString.begin(), dataToWrite.begin(), dataToWrite.begin() + amountToCollect);
-						this->outputBuffers.emplace_back(newString);
-						dataToWrite.erase(dataToWrite.begin(), dataToWrite.begin() + amountToCollect);
-						remainingBytes = dataToWrite.size();
-					}
-				} else {
-					this->outputBuffers.emplace_back(dataToWrite);
-				}
+				this->updateWriteInterest();
 			}
 		}
 		return;
 	}
 
-	std::string& SSLClient::getInputBuffer() noexcept {
+	RingBuffer& SSLClient::getInputBuffer() noexcept {
 		return this->inputBuffer;
 	}
 
@@ -320,84 +489,794 @@ namespace DiscordCoreLoader {
 		return this->bytesRead;
 	}
 
-	bool SSLClient::writeDataProcess() noexcept {
-		if (this->outputBuffers.size() > 0) {
-			size_t writtenBytes{ 0 };
-			auto returnValue{ SSL_write_ex(this->ssl, this->outputBuffers.front().data(), this->outputBuffers.front().size(), &writtenBytes) };
-			auto errorValue{ SSL_get_error(this->ssl, returnValue) };
-			switch (errorValue) {
-				case SSL_ERROR_WANT_READ: {
-					[[fallthrough]];
+	bool SSLClient::processHandshake() noexcept {
+		if (this->theTransport == TransportType::Plain) {
+			this->isHandshakeComplete = this->hasTransport();
+			return this->isHandshakeComplete;
+		}
+		if (!this->ssl) {
+			this->disconnect();
+			return false;
+		}
+		auto returnValue{ SSL_accept(this->ssl) };
+		auto errorValue{ SSL_get_error(this->ssl, returnValue) };
+		switch (errorValue) {
+			case SSL_ERROR_NONE: {
+				this->isHandshakeComplete = true;
+				this->doesHandshakeWantWrite = false;
+				WebSocketSSLServerMain::recordHandshake(this->ssl);
+#if defined(__linux__) && defined(BIO_get_ktls_send)
+				this->isKernelTlsActive = !this->usesMemoryBIOs && BIO_get_ktls_send(SSL_get_wbio(this->ssl));
+#endif
+				this->updateWriteInterest();
+				return true;
+			}
+			case SSL_ERROR_WANT_READ: {
+				this->doesHandshakeWantWrite = false;
+				this->updateWriteInterest();
+				return true;
+			}
+			case SSL_ERROR_WANT_WRITE: {
+				this->doesHandshakeWantWrite = true;
+				this->updateWriteInterest();
+				return true;
+			}
+			default: {
+				if (this->doWePrintError) {
+					std::cout << reportSSLError("SSLClient::processHandshake()", returnValue, this->ssl);
 				}
-				case SSL_ERROR_WANT_WRITE: {
-					[[fallthrough]];
+				this->disconnect();
+				return false;
+			}
+		}
+	}
+
+	bool SSLClient::doWeHaveDataToWrite() noexcept {
+		return this->outputChain.size() > 0 || this->doesHandshakeWantWrite;
+	}
+
+	bool SSLClient::writeDataProcess() noexcept {
+		if (!this->isHandshakeComplete) {
+			return this->processHandshake();
+		}
+		if (this->isKernelTlsActive || (this->theTransport == TransportType::Plain && !this->usesMemoryBIOs)) {
+			return this->writeGatheredProcess();
+		}
+		uint64_t theBudget{ this->usesMemoryBIOs ? OutputChain::theChunkSize : SSLClient::maxWriteBudget };
+		while (this->outputChain.size() > 0 && theBudget > 0) {
+			uint64_t writtenBytes{ 0 };
+			auto theChunk = this->outputChain.front();
+			switch (this->transportWrite(theChunk.data(), theChunk.size(), writtenBytes)) {
+				case TransportStatus::Complete: {
+					this->outputChain.consume(writtenBytes);
+					this->bytesWritten += writtenBytes;
+					theBudget -= std::min<uint64_t>(theBudget, writtenBytes);
+					break;
 				}
-				case SSL_ERROR_NONE: {
-					if (writtenBytes > 0) {
-						this->outputBuffers.erase(this->outputBuffers.begin());
-					}
+				case TransportStatus::Retry: {
+					this->updateWriteInterest();
 					return true;
 				}
-				case SSL_ERROR_ZERO_RETURN: {
-					std::cout << reportSSLError("SSLClient::writeDataProcess()");
-					[[fallthrough]];
-				}
 				default: {
-					std::cout << reportSSLError("SSLClient::writeDataProcess()");
 					this->disconnect();
 					return false;
 				}
 			}
 		}
+		this->updateWriteInterest();
 		return true;
 	}
 
-	bool SSLClient::readDataProcess() noexcept {
-		do {
-			size_t readBytes{ 0 };
-			auto returnValue{ SSL_read_ex(this->ssl, this->rawInputBuffer.data(), this->maxBufferSize, &readBytes) };
-			auto errorValue{ SSL_get_error(this->ssl, returnValue) };
-			switch (errorValue) {
-				case SSL_ERROR_WANT_READ: {
-					[[fallthrough]];
+	bool SSLClient::writeGatheredProcess() noexcept {
+#ifdef __linux__
+		iovec theVectors[16]{};
+		uint64_t theBudget{ SSLClient::maxWriteBudget };
+		while (this->outputChain.size() > 0 && theBudget > 0) {
+			msghdr theMessage{};
+			theMessage.msg_iov = theVectors;
+			theMessage.msg_iovlen = this->outputChain.gather(theVectors, std::size(theVectors));
+			auto writtenBytes = sendmsg(this->clientSocket, &theMessage, MSG_NOSIGNAL);
+			if (writtenBytes < 0) {
+				if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+					this->updateWriteInterest();
+					return true;
 				}
-				case SSL_ERROR_WANT_WRITE: {
-					[[fallthrough]];
+				if (this->doWePrintError) {
+					std::cout << reportError("SSLClient::writeGatheredProcess()::sendmsg()", errno);
 				}
-				case SSL_ERROR_NONE: {
+				this->disconnect();
+				return false;
+			}
+			this->outputChain.consume(static_cast<uint64_t>(writtenBytes));
+			this->bytesWritten += static_cast<uint64_t>(writtenBytes);
+			theBudget -= std::min<uint64_t>(theBudget, static_cast<uint64_t>(writtenBytes));
+		}
+		this->updateWriteInterest();
+#endif
+		return true;
+	}
+
+	bool SSLClient::readDataProcess() noexcept {
+		if (!this->isHandshakeComplete) {
+			if (!this->processHandshake()) {
+				return false;
+			}
+			if (!this->isHandshakeComplete) {
+				return true;
+			}
+		}
+		do {
+			uint64_t readBytes{ 0 };
+			switch (this->transportRead(this->inputBuffer.getWritePointer(this->maxBufferSize), this->maxBufferSize, readBytes)) {
+				case TransportStatus::Complete: {
 					if (readBytes > 0) {
-						this->inputBuffer.append(this->rawInputBuffer.data(), this->rawInputBuffer.data() + readBytes);
+						this->inputBuffer.commitWrite(readBytes);
 						this->bytesRead += readBytes;
 					}
 					break;
 				}
-				case SSL_ERROR_ZERO_RETURN: {
-					std::cout << reportSSLError("SSLClient::readDataProcess()");
+				case TransportStatus::Retry: {
 					break;
 				}
 				default: {
-					std::cout << reportSSLError("SSLClient::readDataProcess()");
 					this->disconnect();
 					return false;
 				}
 			}
 			this->handleBuffer();
-		} while (SSL_pending(this->ssl));
+		} while (this->transportHasPending());
+		return true;
+	}
+
+	TransportStatus SSLClient::transportRead(char* theData, uint64_t theSize, uint64_t& theReadBytes) noexcept {
+		size_t readBytes{ 0 };
+		if (this->theTransport == TransportType::Plain) {
+			if (BIO_read_ex(this->getReadBio(), theData, theSize, &readBytes)) {
+				theReadBytes = readBytes;
+				return TransportStatus::Complete;
+			}
+			if (BIO_should_retry(this->getReadBio())) {
+				return TransportStatus::Retry;
+			}
+			if (this->doWePrintError) {
+				std::cout << shiftToBrightRed() << "SSLClient::transportRead() Error: the connection was closed." << reset() << std::endl;
+			}
+			return TransportStatus::Closed;
+		}
+		auto returnValue{ SSL_read_ex(this->ssl, theData, theSize, &readBytes) };
+		auto errorValue{ SSL_get_error(this->ssl, returnValue) };
+		theReadBytes = readBytes;
+		switch (errorValue) {
+			case SSL_ERROR_WANT_READ: {
+				[[fallthrough]];
+			}
+			case SSL_ERROR_WANT_WRITE: {
+				return TransportStatus::Retry;
+			}
+			case SSL_ERROR_NONE: {
+				return TransportStatus::Complete;
+			}
+			case SSL_ERROR_ZERO_RETURN: {
+				std::cout << reportSSLError("SSLClient::readDataProcess()");
+				return TransportStatus::Closed;
+			}
+			default: {
+				std::cout << reportSSLError("SSLClient::readDataProcess()");
+				return TransportStatus::Failed;
+			}
+		}
+	}
+
+	TransportStatus SSLClient::transportWrite(const char* theData, uint64_t theSize, uint64_t& theWrittenBytes) noexcept {
+		size_t writtenBytes{ 0 };
+		if (this->theTransport == TransportType::Plain) {
+			if (BIO_write_ex(this->getWriteBio(), theData, theSize, &writtenBytes)) {
+				theWrittenBytes = writtenBytes;
+				return TransportStatus::Complete;
+			}
+			if (BIO_should_retry(this->getWriteBio())) {
+				return TransportStatus::Retry;
+			}
+			if (this->doWePrintError) {
+				std::cout << shiftToBrightRed() << "SSLClient::transportWrite() Error: the connection was closed." << reset() << std::endl;
+			}
+			return TransportStatus::Failed;
+		}
+		auto returnValue{ SSL_write_ex(this->ssl, theData, theSize, &writtenBytes) };
+		auto errorValue{ SSL_get_error(this->ssl, returnValue) };
+		theWrittenBytes = writtenBytes;
+		switch (errorValue) {
+			case SSL_ERROR_WANT_READ: {
+				[[fallthrough]];
+			}
+			case SSL_ERROR_WANT_WRITE: {
+				return TransportStatus::Retry;
+			}
+			case SSL_ERROR_NONE: {
+				return TransportStatus::Complete;
+			}
+			case SSL_ERROR_ZERO_RETURN: {
+				std::cout << reportSSLError("SSLClient::writeDataProcess()");
+				[[fallthrough]];
+			}
+			default: {
+				std::cout << reportSSLError("SSLClient::writeDataProcess()");
+				return TransportStatus::Failed;
+			}
+		}
+	}
+
+	bool SSLClient::transportHasPending() noexcept {
+		if (this->theTransport == TransportType::Plain) {
+			return false;
+		}
+		return SSL_pending(this->ssl) > 0;
+	}
+
+	bool SSLClient::hasTransport() noexcept {
+		return this->theTransport == TransportType::Plain ? this->getReadBio() != nullptr : this->ssl != nullptr;
+	}
+
+	BIO* SSLClient::getReadBio() noexcept {
+		if (this->theTransport == TransportType::Plain) {
+			return this->plainBio;
+		}
+		return this->ssl ? SSL_get_rbio(this->ssl) : nullptr;
+	}
+
+	BIO* SSLClient::getWriteBio() noexcept {
+		if (this->theTransport == TransportType::Plain) {
+			return this->plainWriteBio ? this->plainWriteBio : this->plainBio;
+		}
+		return this->ssl ? SSL_get_wbio(this->ssl) : nullptr;
+	}
+
+	bool SSLClient::enableMemoryBIOs() noexcept {
+		if (this->usesMemoryBIOs) {
+			return true;
+		}
+		if (!this->hasTransport()) {
+			return false;
+		}
+#if defined(__linux__) && defined(BIO_get_ktls_recv)
+		if (this->isKernelTlsActive || (this->ssl && BIO_get_ktls_recv(SSL_get_rbio(this->ssl)))) {
+			if (this->doWePrintError) {
+				std::cout << shiftToBrightRed() << "A kernel TLS connection cannot move to memory BIOs, dropping it." << reset() << std::endl;
+			}
+			return false;
+		}
+#endif
+		BIO* readBio{ BIO_new(BIO_s_mem()) };
+		BIO* writeBio{ BIO_new(BIO_s_mem()) };
+		if (!readBio || !writeBio) {
+			if (this->doWePrintError) {
+				std::cout << reportSSLError("SSLClient::enableMemoryBIOs()::BIO_new()");
+			}
+			BIO_free(readBio);
+			BIO_free(writeBio);
+			return false;
+		}
+		BIO_set_mem_eof_return(readBio, -1);
+		if (this->theTransport == TransportType::Plain) {
+			this->plainBio = readBio;
+			this->plainWriteBio = writeBio;
+		} else {
+			SSL_set_bio(this->ssl, readBio, writeBio);
+		}
+		this->usesMemoryBIOs = true;
 		return true;
 	}
 
+	void SSLClient::updateWriteInterest() noexcept {
+		if (this->theReactor && (this->usesMemoryBIOs || this->doWeWantToWrite != this->doWeHaveDataToWrite())) {
+			this->theReactor->setWriteInterest(this, this->doWeHaveDataToWrite());
+		}
+	}
+
 	void SSLClient::disconnect() noexcept {
 		if (this->clientSocket != SOCKET_ERROR) {
+			if (this->theReactor) {
+				this->theReactor->unregisterClient(this);
+			}
 			this->clientSocket = SOCKET_ERROR;
-			this->outputBuffers.clear();
+			this->outputChain.clear();
 			this->inputBuffer.clear();
 		}
 	}
 
 	SSLClient::~SSLClient() {
+		if (this->theReactor) {
+			this->theReactor->unregisterClient(this);
+		}
 		this->areWeConnected = false;
 	}
 
+	EventReactor::EventReactor(IOBackend theBackend) noexcept {
+#ifndef _WIN32
+		if (this->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); this->wakeFd == -1) {
+			std::cout << reportError("EventReactor::EventReactor()::eventfd()", this->wakeFd);
+		}
+#endif
+#ifdef DISCORDCORELOADER_IO_URING
+		if (theBackend == IOBackend::IoUring) {
+			if (auto returnValue = io_uring_queue_init(EventReactor::ringEntryCount, &this->theRing, 0); returnValue == 0) {
+				this->isRingActive = true;
+				this->armWake();
+				return;
+			} else {
+				std::cout << shiftToBrightRed() << "EventReactor::EventReactor()::io_uring_queue_init() Error: " << strerror(-returnValue)
+						  << ", falling back to epoll." << reset() << std::endl
+						  << std::endl;
+			}
+		}
+#else
+		if (theBackend == IOBackend::IoUring) {
+			std::cout << shiftToBrightRed() << "io_uring support was not compiled in, falling back to the default reactor." << reset() << std::endl
+					  << std::endl;
+		}
+#endif
+#ifndef _WIN32
+		this->theEvents.resize(EventReactor::maxEventsPerWait);
+		if (this->epollFd = epoll_create1(EPOLL_CLOEXEC); this->epollFd == -1) {
+			std::cout << reportError("EventReactor::EventReactor()::epoll_create1()", this->epollFd);
+		} else if (this->wakeFd != -1) {
+			epoll_event theEvent{};
+			theEvent.events = EPOLLIN;
+			theEvent.data.ptr = nullptr;
+			if (auto returnValue = epoll_ctl(this->epollFd, EPOLL_CTL_ADD, this->wakeFd, &theEvent); returnValue == -1) {
+				std::cout << reportError("EventReactor::EventReactor()::epoll_ctl()", returnValue);
+			}
+		}
+#endif
+	}
+
+	void EventReactor::wake() noexcept {
+#ifndef _WIN32
+		if (this->wakeFd != -1 && !this->isWakePending.exchange(true, std::memory_order_acq_rel)) {
+			uint64_t theValue{ 1 };
+			[[maybe_unused]] auto returnValue = write(this->wakeFd, &theValue, sizeof(theValue));
+		}
+#endif
+	}
+
+#ifndef _WIN32
+	void EventReactor::drainWake() noexcept {
+		uint64_t theValue{};
+		[[maybe_unused]] auto returnValue = read(this->wakeFd, &theValue, sizeof(theValue));
+		this->isWakePending.store(false, std::memory_order_release);
+	}
+#endif
+
+	bool EventReactor::registerClient(SSLClient* theClient) noexcept {
+		if (!theClient || theClient->clientSocket == SOCKET_ERROR) {
+			return false;
+		}
+		theClient->doWeWantToWrite = theClient->doWeHaveDataToWrite();
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			if (!theClient->enableMemoryBIOs()) {
+				return false;
+			}
+			auto theSlotId = ++this->currentSlotId;
+			auto theSlot = std::make_unique<IoUringSlot>();
+			theSlot->theSocket = theClient->clientSocket;
+			theSlot->theClient = theClient;
+			this->theSlots[theSlotId] = std::move(theSlot);
+			this->theSlotIndices[theClient] = theSlotId;
+			theClient->theReactor = this;
+			if (theClient->doWeWantToWrite) {
+				this->theWritableSlots.emplace(theSlotId);
+			}
+			this->theDirtySlots.emplace(theSlotId);
+			this->armRecv(theSlotId);
+			return true;
+		}
+#endif
+#ifdef _WIN32
+		pollfd theWrapper{};
+		theWrapper.fd = theClient->clientSocket;
+		theWrapper.events = theClient->doWeWantToWrite ? POLLIN | POLLOUT : POLLIN;
+		this->theIndices[theClient] = this->thePolls.size();
+		this->thePolls.emplace_back(theWrapper);
+		this->theClients.emplace_back(theClient);
+#else
+		epoll_event theEvent{};
+		theEvent.events = theClient->doWeWantToWrite ? EPOLLIN | EPOLLOUT : EPOLLIN;
+		theEvent.data.ptr = theClient;
+		if (auto returnValue = epoll_ctl(this->epollFd, EPOLL_CTL_ADD, theClient->clientSocket, &theEvent); returnValue == -1) {
+			if (theClient->doWePrintError) {
+				std::cout << reportError("EventReactor::registerClient()::epoll_ctl()", returnValue);
+			}
+			return false;
+		}
+#endif
+		theClient->theReactor = this;
+		return true;
+	}
+
+	bool EventReactor::registerListener(SOCKET theListener) noexcept {
+		if (theListener == SOCKET_ERROR) {
+			return false;
+		}
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			return false;
+		}
+#endif
+#ifdef _WIN32
+		return false;
+#else
+		epoll_event theEvent{};
+		theEvent.events = EPOLLIN;
+		theEvent.data.ptr = this;
+		if (auto returnValue = epoll_ctl(this->epollFd, EPOLL_CTL_ADD, theListener, &theEvent); returnValue == -1) {
+			std::cout << reportError("EventReactor::registerListener()::epoll_ctl()", returnValue);
+			return false;
+		}
+		return true;
+#endif
+	}
+
+	void EventReactor::unregisterClient(SSLClient* theClient) noexcept {
+		if (!theClient || theClient->theReactor != this) {
+			return;
+		}
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			if (this->theSlotIndices.contains(theClient)) {
+				auto theSlotId = this->theSlotIndices[theClient];
+				this->theSlotIndices.erase(theClient);
+				this->theWritableSlots.erase(theSlotId);
+				this->theDirtySlots.erase(theSlotId);
+				auto& theSlot = this->theSlots[theSlotId];
+				theSlot->theClient = nullptr;
+				if (theSlot->isRecvPending || theSlot->isSendPending) {
+					for (uint64_t theOperation: { uint64_t{ 0 }, uint64_t{ 1 } }) {
+						if (auto theEntry = this->getSubmissionEntry(); theEntry) {
+							io_uring_prep_cancel64(theEntry, (theSlotId << 1) | theOperation, 0);
+							io_uring_sqe_set_data64(theEntry, 0);
+						}
+					}
+					io_uring_submit(&this->theRing);
+				} else {
+					this->theSlots.erase(theSlotId);
+				}
+			}
+			theClient->theReactor = nullptr;
+			theClient->doWeWantToWrite = false;
+			return;
+		}
+#endif
+#ifdef _WIN32
+		if (this->theIndices.contains(theClient)) {
+			auto theIndex = this->theIndices[theClient];
+			this->theIndices.erase(theClient);
+			if (theIndex != this->thePolls.size() - 1) {
+				this->thePolls[theIndex] = this->thePolls.back();
+				this->theClients[theIndex] = this->theClients.back();
+				this->theIndices[this->theClients[theIndex]] = theIndex;
+			}
+			this->thePolls.pop_back();
+			this->theClients.pop_back();
+		}
+#else
+		epoll_event theEvent{};
+		epoll_ctl(this->epollFd, EPOLL_CTL_DEL, theClient->clientSocket, &theEvent);
+#endif
+		theClient->theReactor = nullptr;
+		theClient->doWeWantToWrite = false;
+	}
+
+	void EventReactor::setWriteInterest(SSLClient* theClient, bool doWeWantToWrite) noexcept {
+		if (!theClient || theClient->theReactor != this || theClient->clientSocket == SOCKET_ERROR) {
+			return;
+		}
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			if (this->theSlotIndices.contains(theClient)) {
+				auto theSlotId = this->theSlotIndices[theClient];
+				if (doWeWantToWrite) {
+					this->theWritableSlots.emplace(theSlotId);
+				} else {
+					this->theWritableSlots.erase(theSlotId);
+				}
+				this->theDirtySlots.emplace(theSlotId);
+			}
+			theClient->doWeWantToWrite = doWeWantToWrite;
+			return;
+		}
+#endif
+#ifdef _WIN32
+		if (this->theIndices.contains(theClient)) {
+			this->thePolls[this->theIndices[theClient]].events = doWeWantToWrite ? POLLIN | POLLOUT : POLLIN;
+		}
+#else
+		epoll_event theEvent{};
+		theEvent.events = doWeWantToWrite ? EPOLLIN | EPOLLOUT : EPOLLIN;
+		theEvent.data.ptr = theClient;
+		if (auto returnValue = epoll_ctl(this->epollFd, EPOLL_CTL_MOD, theClient->clientSocket, &theEvent); returnValue == -1) {
+			if (theClient->doWePrintError) {
+				std::cout << reportError("EventReactor::setWriteInterest()::epoll_ctl()", returnValue);
+			}
+			return;
+		}
+#endif
+		theClient->doWeWantToWrite = doWeWantToWrite;
+	}
+
+	std::vector<SSLClient*> EventReactor::processIO(int32_t timeoutInMs, std::vector<SSLClient*>* theReadyClients) noexcept {
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			return this->processIOUring(timeoutInMs, theReadyClients);
+		}
+#endif
+		std::vector<SSLClient*> returnValue02{};
+#ifdef _WIN32
+		timeoutInMs = timeoutInMs < 0 ? EventReactor::maxPollWaitInMs : std::min(timeoutInMs, EventReactor::maxPollWaitInMs);
+		if (this->thePolls.size() == 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds{ timeoutInMs });
+			return returnValue02;
+		}
+		if (auto returnValue = poll(this->thePolls.data(), static_cast<unsigned long>(this->thePolls.size()), timeoutInMs);
+			returnValue == SOCKET_ERROR) {
+			for (uint64_t x = 0; x < this->thePolls.size(); ++x) {
+				if (this->thePolls[x].revents & POLLERR || this->thePolls[x].revents & POLLHUP || this->thePolls[x].revents & POLLNVAL) {
+					returnValue02.emplace_back(this->theClients[x]);
+				}
+			}
+			return returnValue02;
+		} else if (returnValue == 0) {
+			return returnValue02;
+		}
+		std::vector<std::pair<SSLClient*, int16_t>> theReadySet{};
+		for (uint64_t x = 0; x < this->thePolls.size(); ++x) {
+			if (this->thePolls[x].revents) {
+				theReadySet.emplace_back(this->theClients[x], this->thePolls[x].revents);
+			}
+		}
+		for (auto& [theClient, theEvents]: theReadySet) {
+			if (theReadyClients) {
+				theReadyClients->emplace_back(theClient);
+			}
+			if (theEvents & POLLOUT) {
+				if (!theClient->writeDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					continue;
+				}
+			}
+			if (theEvents & (POLLIN | POLLERR | POLLHUP)) {
+				if (!theClient->readDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					continue;
+				}
+			}
+		}
+#else
+		auto returnValue = epoll_wait(this->epollFd, this->theEvents.data(), EventReactor::maxEventsPerWait, timeoutInMs);
+		if (returnValue == -1) {
+			if (errno != EINTR) {
+				std::cout << reportError("EventReactor::processIO()::epoll_wait()", returnValue);
+			}
+			return returnValue02;
+		}
+		for (int32_t x = 0; x < returnValue; ++x) {
+			if (this->theEvents[x].data.ptr == this) {
+				continue;
+			}
+			auto theClient = static_cast<SSLClient*>(this->theEvents[x].data.ptr);
+			if (!theClient) {
+				this->drainWake();
+				continue;
+			}
+			if (theReadyClients) {
+				theReadyClients->emplace_back(theClient);
+			}
+			if (this->theEvents[x].events & EPOLLOUT) {
+				if (!theClient->writeDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					continue;
+				}
+			}
+			if (this->theEvents[x].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+				if (!theClient->readDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					continue;
+				}
+			}
+		}
+#endif
+		return returnValue02;
+	}
+
+#ifdef DISCORDCORELOADER_IO_URING
+	io_uring_sqe* EventReactor::getSubmissionEntry() noexcept {
+		auto theEntry = io_uring_get_sqe(&this->theRing);
+		if (!theEntry) {
+			io_uring_submit(&this->theRing);
+			theEntry = io_uring_get_sqe(&this->theRing);
+		}
+		return theEntry;
+	}
+
+	void EventReactor::armRecv(uint64_t theSlotId) noexcept {
+		auto& theSlot = this->theSlots[theSlotId];
+		if (theSlot->isRecvPending || !theSlot->theClient) {
+			return;
+		}
+		if (auto theEntry = this->getSubmissionEntry(); theEntry) {
+			io_uring_prep_recv(theEntry, theSlot->theSocket, theSlot->recvBuffer.get(), 1024 * 16, 0);
+			io_uring_sqe_set_data64(theEntry, theSlotId << 1);
+			theSlot->isRecvPending = true;
+		}
+	}
+
+	void EventReactor::armWake() noexcept {
+		if (this->wakeFd == -1) {
+			return;
+		}
+		if (auto theEntry = this->getSubmissionEntry(); theEntry) {
+			io_uring_prep_read(theEntry, this->wakeFd, &this->theWakeValue, sizeof(this->theWakeValue), 0);
+			io_uring_sqe_set_data64(theEntry, EventReactor::wakeUserData);
+		}
+	}
+
+	void EventReactor::flushSlot(uint64_t theSlotId) noexcept {
+		auto& theSlot = this->theSlots[theSlotId];
+		if (!theSlot->theClient || !theSlot->theClient->hasTransport()) {
+			return;
+		}
+		BIO* writeBio{ theSlot->theClient->getWriteBio() };
+		while (BIO_ctrl_pending(writeBio) > 0) {
+			auto thePendingSize = BIO_ctrl_pending(writeBio);
+			auto theCurrentSize = theSlot->stagingBuffer.size();
+			theSlot->stagingBuffer.resize(theCurrentSize + thePendingSize);
+			auto readBytes = BIO_read(writeBio, theSlot->stagingBuffer.data() + theCurrentSize, static_cast<int32_t>(thePendingSize));
+			theSlot->stagingBuffer.resize(theCurrentSize + (readBytes > 0 ? readBytes : 0));
+			if (readBytes <= 0) {
+				break;
+			}
+		}
+		if (theSlot->isSendPending) {
+			return;
+		}
+		if (theSlot->sendOffset >= theSlot->sendBuffer.size() && theSlot->stagingBuffer.size() > 0) {
+			theSlot->sendBuffer.clear();
+			std::swap(theSlot->sendBuffer, theSlot->stagingBuffer);
+			theSlot->sendOffset = 0;
+		}
+		if (theSlot->sendOffset < theSlot->sendBuffer.size()) {
+			if (auto theEntry = this->getSubmissionEntry(); theEntry) {
+				io_uring_prep_send(theEntry, theSlot->theSocket, theSlot->sendBuffer.data() + theSlot->sendOffset,
+					theSlot->sendBuffer.size() - theSlot->sendOffset, MSG_NOSIGNAL);
+				io_uring_sqe_set_data64(theEntry, (theSlotId << 1) | 1);
+				theSlot->isSendPending = true;
+			}
+		}
+	}
+
+	std::vector<SSLClient*> EventReactor::processIOUring(int32_t timeoutInMs, std::vector<SSLClient*>* theReadyClients) noexcept {
+		std::vector<SSLClient*> returnValue02{};
+		std::vector<uint64_t> theWritableSlotsNew{ this->theWritableSlots.begin(), this->theWritableSlots.end() };
+		for (auto& theSlotId: theWritableSlotsNew) {
+			if (!this->theSlots.contains(theSlotId) || !this->theSlots[theSlotId]->theClient) {
+				continue;
+			}
+			auto& theSlot = this->theSlots[theSlotId];
+			auto theClient = theSlot->theClient;
+			while (theClient->isHandshakeComplete && theClient->outputChain.size() > 0 &&
+				theSlot->sendBuffer.size() - theSlot->sendOffset + theSlot->stagingBuffer.size() < EventReactor::maxSendBacklog) {
+				if (!theClient->writeDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					break;
+				}
+				this->flushSlot(theSlotId);
+			}
+		}
+		std::vector<uint64_t> theDirtySlotsNew{ this->theDirtySlots.begin(), this->theDirtySlots.end() };
+		this->theDirtySlots.clear();
+		for (auto& theSlotId: theDirtySlotsNew) {
+			if (this->theSlots.contains(theSlotId)) {
+				this->flushSlot(theSlotId);
+			}
+		}
+
+		io_uring_submit(&this->theRing);
+		io_uring_cqe* theCompletion{ nullptr };
+		__kernel_timespec theTimeout{ .tv_sec = timeoutInMs / 1000, .tv_nsec = (timeoutInMs % 1000) * 1000000ll };
+		if (auto returnValue = io_uring_wait_cqe_timeout(&this->theRing, &theCompletion, timeoutInMs < 0 ? nullptr : &theTimeout); returnValue < 0) {
+			if (returnValue != -ETIME && returnValue != -EINTR) {
+				std::cout << shiftToBrightRed() << "EventReactor::processIOUring()::io_uring_wait_cqe_timeout() Error: " << strerror(-returnValue)
+						  << reset() << std::endl
+						  << std::endl;
+			}
+			return returnValue02;
+		}
+
+		std::vector<std::pair<uint64_t, int32_t>> theCompletions{};
+		uint32_t theHead{};
+		io_uring_for_each_cqe(&this->theRing, theHead, theCompletion) {
+			theCompletions.emplace_back(io_uring_cqe_get_data64(theCompletion), theCompletion->res);
+		}
+		io_uring_cq_advance(&this->theRing, static_cast<uint32_t>(theCompletions.size()));
+
+		for (auto& [theUserData, theResult]: theCompletions) {
+			if (theUserData == EventReactor::wakeUserData) {
+				this->isWakePending.store(false, std::memory_order_release);
+				this->armWake();
+				continue;
+			}
+			auto theSlotId = theUserData >> 1;
+			bool isItASend = theUserData & 1;
+			if (theSlotId == 0 || !this->theSlots.contains(theSlotId)) {
+				continue;
+			}
+			auto& theSlot = this->theSlots[theSlotId];
+			if (isItASend) {
+				theSlot->isSendPending = false;
+			} else {
+				theSlot->isRecvPending = false;
+			}
+			auto theClient = theSlot->theClient;
+			if (!theClient) {
+				if (!theSlot->isRecvPending && !theSlot->isSendPending) {
+					this->theSlots.erase(theSlotId);
+				}
+				continue;
+			}
+			if (theResult == -EAGAIN || theResult == -EINTR) {
+				if (isItASend) {
+					this->theDirtySlots.emplace(theSlotId);
+				} else {
+					this->armRecv(theSlotId);
+				}
+				continue;
+			}
+			if (theResult <= 0) {
+				returnValue02.emplace_back(theClient);
+				theClient->disconnect();
+				continue;
+			}
+			if (theReadyClients) {
+				theReadyClients->emplace_back(theClient);
+			}
+			if (isItASend) {
+				theSlot->sendOffset += static_cast<uint64_t>(theResult);
+				this->theDirtySlots.emplace(theSlotId);
+			} else {
+				BIO_write(theClient->getReadBio(), theSlot->recvBuffer.get(), theResult);
+				if (!theClient->readDataProcess()) {
+					returnValue02.emplace_back(theClient);
+					continue;
+				}
+				if (this->theSlots.contains(theSlotId) && this->theSlots[theSlotId]->theClient) {
+					this->theDirtySlots.emplace(theSlotId);
+					this->armRecv(theSlotId);
+				}
+			}
+		}
+		return returnValue02;
+	}
+#endif
+
+	EventReactor::~EventReactor() noexcept {
+#ifdef DISCORDCORELOADER_IO_URING
+		if (this->isRingActive) {
+			io_uring_queue_exit(&this->theRing);
+			this->isRingActive = false;
+		}
+#endif
+#ifndef _WIN32
+		if (this->epollFd != -1) {
+			close(this->epollFd);
+			this->epollFd = -1;
+		}
+		if (this->wakeFd != -1) {
+			close(this->wakeFd);
+			this->wakeFd = -1;
+		}
+#endif
+	}
+
 	WebSocketSSLServerMain::WebSocketSSLServerMain(const std::string& baseUrlNew, const std::string& portNew, bool doWePrintErrorNew,
 		std::atomic_bool* doWeQuitNew, ConfigParser* theData) {
 		this->doWePrintError = doWePrintErrorNew;
@@ -426,34 +1305,11 @@ namespace DiscordCoreLoader {
 			return;
 		}
 
-		if (this->theServerSocket = socket(this->addrInfo->ai_family, this->addrInfo->ai_socktype, this->addrInfo->ai_protocol);
-			this->theServerSocket == SOCKET_ERROR) {
-			if (this->doWePrintError) {
-				reportError("socket() Error: ", this->theServerSocket);
-			}
-			return;
-		}
-
-		std::unique_ptr<char> optVal{ new char{ 1 } };
-		if (auto returnValue = setsockopt(this->theServerSocket, SOL_SOCKET, SO_REUSEADDR, optVal.get(), sizeof(optVal)); returnValue < 0) {
-			if (this->doWePrintError) {
-				reportError("setsockopt() Error: ", returnValue);
-			}
-			return;
-		}
-
-		if (auto returnValue = bind(this->theServerSocket, this->addrInfo->ai_addr, static_cast<int32_t>(this->addrInfo->ai_addrlen));
-			returnValue != 0) {
-			if (this->doWePrintError) {
-				reportError("bind() Error: ", returnValue);
-			}
+		if (this->theServerSocket = this->createListeningSocket(); this->theServerSocket == SOCKET_ERROR) {
 			return;
 		}
 
-		if (auto returnValue = listen(this->theServerSocket, 5); returnValue != 0) {
-			if (this->doWePrintError) {
-				reportError("listen() Error: ", returnValue);
-			}
+		if (this->theConfigParser && this->theConfigParser->getTheData().transport == TransportType::Plain) {
 			return;
 		}
 
@@ -478,6 +1334,28 @@ namespace DiscordCoreLoader {
 			return;
 		}
 
+		if (this->theConfigParser && this->theConfigParser->getTheData().doWeUseKernelTls) {
+#ifdef SSL_OP_ENABLE_KTLS
+	#ifdef DISCORDCORELOADER_IO_URING
+			// io_uring agents move TLS into memory BIOs, which a socket that is already in kernel TLS mode cannot take back.
+			if (this->theConfigParser->getTheData().ioBackend == IOBackend::IoUring) {
+				if (this->doWePrintError) {
+					std::cout << shiftToBrightRed() << "UseKernelTls is ignored with the io_uring backend, which encrypts in user space." << reset()
+							  << std::endl;
+				}
+			} else {
+				SSL_CTX_set_options(this->context, SSL_OP_ENABLE_KTLS);
+			}
+	#else
+			SSL_CTX_set_options(this->context, SSL_OP_ENABLE_KTLS);
+	#endif
+#else
+			if (this->doWePrintError) {
+				std::cout << shiftToBrightRed() << "This OpenSSL build has no kTLS support, so UseKernelTls is ignored." << reset() << std::endl;
+			}
+#endif
+		}
+
 		if (SSL_CTX_use_certificate_chain_file(this->context, certPath.c_str()) <= 0) {
 			if (this->doWePrintError) {
 				reportSSLError("SSL_CTX_use_certificate_chain_file() Error: ");
@@ -492,6 +1370,30 @@ namespace DiscordCoreLoader {
 			return;
 		}
 
+		SSL_CTX_set_app_data(this->context, this);
+
+		if (!SSL_CTX_set_session_id_context(this->context, reinterpret_cast<const unsigned char*>(WebSocketSSLServerMain::theSessionIdContext),
+				sizeof(WebSocketSSLServerMain::theSessionIdContext) - 1)) {
+			if (this->doWePrintError) {
+				reportSSLError("SSL_CTX_set_session_id_context() Error: ");
+			}
+			return;
+		}
+
+		const ConfigData theDefaults{};
+		auto& theConfigData = this->theConfigParser ? this->theConfigParser->getTheData() : theDefaults;
+		if (theConfigData.tlsSessionCacheSize > 0) {
+			SSL_CTX_set_session_cache_mode(this->context, SSL_SESS_CACHE_SERVER);
+			SSL_CTX_sess_set_cache_size(this->context, static_cast<long>(theConfigData.tlsSessionCacheSize));
+		} else {
+			SSL_CTX_set_session_cache_mode(this->context, SSL_SESS_CACHE_OFF);
+		}
+
+		if (!theConfigData.doWeUseTlsSessionTickets) {
+			SSL_CTX_set_options(this->context, SSL_OP_NO_TICKET);
+			SSL_CTX_set_num_tickets(this->context, 0);
+		}
+
 		SSL_CTX_set_verify(this->context, SSL_VERIFY_PEER, NULL);
 		if (!SSL_CTX_load_verify_locations(this->context, "Cert.pem", NULL)) {
 			if (this->doWePrintError) {
@@ -501,87 +1403,135 @@ namespace DiscordCoreLoader {
 		}
 	};
 
-	std::vector<WebSocketSSLShard*> WebSocketSSLServerMain::processIO(std::vector<WebSocketSSLShard*>& theVector) noexcept {
-		PollFDWrapper readWriteSet{};
-		for (uint32_t x = 0; x < theVector.size(); ++x) {
-			pollfd theWrapper{};
-			theWrapper.fd = theVector[x]->clientSocket;
-			if (theVector[x]->outputBuffers.size() > 0) {
-				theWrapper.events = POLLIN | POLLOUT;
-			} else {
-				theWrapper.events = POLLIN;
+	bool WebSocketSSLServerMain::doWeUseReusePort() noexcept {
+#ifdef SO_REUSEPORT
+		return this->theConfigParser && this->theConfigParser->getTheData().doWeUseReusePortListeners;
+#else
+		return false;
+#endif
+	}
+
+	void WebSocketSSLServerMain::recordHandshake(SSL* theSsl) noexcept {
+		auto theServer = static_cast<WebSocketSSLServerMain*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(theSsl)));
+		if (!theServer) {
+			return;
+		}
+		if (SSL_session_reused(theSsl)) {
+			theServer->theResumedHandshakeCount.fetch_add(1, std::memory_order_relaxed);
+		} else {
+			theServer->theFullHandshakeCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	uint64_t WebSocketSSLServerMain::getFullHandshakeCount() noexcept {
+		return this->theFullHandshakeCount.load(std::memory_order_relaxed);
+	}
+
+	uint64_t WebSocketSSLServerMain::getResumedHandshakeCount() noexcept {
+		return this->theResumedHandshakeCount.load(std::memory_order_relaxed);
+	}
+
+	SOCKET WebSocketSSLServerMain::createListeningSocket() {
+		SOCKETWrapper theSocket{ socket(this->addrInfo->ai_family, this->addrInfo->ai_socktype, this->addrInfo->ai_protocol) };
+		if (theSocket == SOCKET_ERROR) {
+			if (this->doWePrintError) {
+				reportError("socket() Error: ", theSocket);
 			}
-			readWriteSet.theIndices.emplace_back(x);
-			readWriteSet.thePolls.emplace_back(theWrapper);
+			return SOCKET_ERROR;
 		}
 
-		std::vector<WebSocketSSLShard*> returnValue02{};
-		if (readWriteSet.theIndices.size() == 0) {
-			return returnValue02;
+		const int32_t optionValue{ true };
+		if (auto returnValue = setsockopt(theSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&optionValue), sizeof(int32_t));
+			returnValue < 0) {
+			if (this->doWePrintError) {
+				reportError("setsockopt() Error: ", returnValue);
+			}
+			return SOCKET_ERROR;
 		}
 
-		if (auto returnValue = poll(readWriteSet.thePolls.data(), static_cast<unsigned long>(readWriteSet.theIndices.size()), 1);
-			returnValue == SOCKET_ERROR) {
-			for (uint32_t x = 0; x < readWriteSet.thePolls.size(); ++x) {
-				if (readWriteSet.thePolls[x].revents & POLLERR || readWriteSet.thePolls[x].revents & POLLHUP ||
-					readWriteSet.thePolls[x].revents & POLLNVAL) {
-					returnValue02.emplace_back(theVector[readWriteSet.theIndices[x]]);
+#ifdef SO_REUSEPORT
+		if (this->doWeUseReusePort()) {
+			if (auto returnValue = setsockopt(theSocket, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&optionValue), sizeof(int32_t));
+				returnValue < 0) {
+				if (this->doWePrintError) {
+					reportError("setsockopt() Error: ", returnValue);
 				}
+				return SOCKET_ERROR;
 			}
-			return returnValue02;
+		}
+#endif
 
-		} else if (returnValue == 0) {
-			return returnValue02;
+		if (auto returnValue = bind(theSocket, this->addrInfo->ai_addr, static_cast<int32_t>(this->addrInfo->ai_addrlen)); returnValue != 0) {
+			if (this->doWePrintError) {
+				reportError("bind() Error: ", returnValue);
+			}
+			return SOCKET_ERROR;
 		}
 
-		for (uint32_t x = 0; x < readWriteSet.theIndices.size(); ++x) {
-			if (readWriteSet.thePolls[x].revents & POLLOUT) {
-				if (!theVector[readWriteSet.theIndices[x]]->writeDataProcess()) {
-					returnValue02.emplace_back(theVector[readWriteSet.theIndices[x]]);
-					continue;
-				}
+		int32_t theBacklog{ SOMAXCONN };
+		if (this->theConfigParser) {
+			theBacklog = static_cast<int32_t>(std::min<uint64_t>(this->theConfigParser->getTheData().listenBacklog, INT32_MAX));
+		}
+		if (auto returnValue = listen(theSocket, theBacklog); returnValue != 0) {
+			if (this->doWePrintError) {
+				reportError("listen() Error: ", returnValue);
 			}
-			if (readWriteSet.thePolls[x].revents & POLLIN) {
-				if (!theVector[readWriteSet.theIndices[x]]->readDataProcess()) {
-					returnValue02.emplace_back(theVector[readWriteSet.theIndices[x]]);
-					continue;
-				}
+			return SOCKET_ERROR;
+		}
+
+#ifdef _WIN32
+		u_long theNonBlockingValue{ 1 };
+		if (ioctlsocket(theSocket, FIONBIO, &theNonBlockingValue)) {
+			if (this->doWePrintError) {
+				reportError("ioctlsocket() Error: ", theSocket);
 			}
-			theVector[readWriteSet.theIndices[x]]->handleBuffer();
+			return SOCKET_ERROR;
 		}
-		return returnValue02;
+#else
+		if (fcntl(theSocket, F_SETFL, fcntl(theSocket, F_GETFL, 0) | O_NONBLOCK)) {
+			if (this->doWePrintError) {
+				reportError("fcntl() Error: ", theSocket);
+			}
+			return SOCKET_ERROR;
+		}
+#endif
+		SOCKET returnValue{ theSocket };
+		*static_cast<SOCKET*>(theSocket) = static_cast<SOCKET>(SOCKET_ERROR);
+		return returnValue;
 	}
 
-	SOCKET WebSocketSSLServerMain::getNewSocket() {
-		SOCKET newSocket{ static_cast<SOCKET>(SOCKET_ERROR) };
+	SOCKET WebSocketSSLServerMain::getNewSocket(SOCKET theListener) {
+		sockaddr_storage theAddress{};
 #ifdef _WIN32
-		auto theSize = static_cast<int32_t>(this->addrInfo->ai_addrlen);
+		auto theSize = static_cast<int32_t>(sizeof(theAddress));
 #else
-		auto theSize = static_cast<uint32_t>(this->addrInfo->ai_addrlen);
+		auto theSize = static_cast<uint32_t>(sizeof(theAddress));
 #endif
-		while (newSocket == SOCKET_ERROR && !this->doWeQuit->load()) {
-			newSocket = accept(this->theServerSocket, this->addrInfo->ai_addr, &theSize);
+		SOCKET newSocket = accept(theListener, reinterpret_cast<sockaddr*>(&theAddress), &theSize);
+		if (newSocket == SOCKET_ERROR) {
+			return SOCKET_ERROR;
+		}
 
-			const char optionValue{ true };
-			if (setsockopt(newSocket, IPPROTO_TCP, TCP_NODELAY, &optionValue, sizeof(int32_t))) {
-				if (this->doWePrintError) {
-					reportError("SSLClient::connect::setsockopt()", newSocket);
-				}
-				return SOCKET_ERROR;
+		const int32_t optionValue{ true };
+		if (setsockopt(newSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&optionValue), sizeof(int32_t))) {
+			if (this->doWePrintError) {
+				reportError("SSLClient::connect::setsockopt()", newSocket);
 			}
+			SOCKETWrapper theWrapper{ newSocket };
+			return SOCKET_ERROR;
+		}
 #ifdef _WIN32
-			u_long value02{ 1 };
-			if (ioctlsocket(newSocket, FIONBIO, &value02)) {
-				return SOCKET_ERROR;
-			}
+		u_long value02{ 1 };
+		if (ioctlsocket(newSocket, FIONBIO, &value02)) {
+			SOCKETWrapper theWrapper{ newSocket };
+			return SOCKET_ERROR;
+		}
 #else
-			if (fcntl(newSocket, F_SETFL, fcntl(newSocket, F_GETFL, 0) | O_NONBLOCK)) {
-				return SOCKET_ERROR;
-			}
-#endif
-
-			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+		if (fcntl(newSocket, F_SETFL, fcntl(newSocket, F_GETFL, 0) | O_NONBLOCK)) {
+			SOCKETWrapper theWrapper{ newSocket };
+			return SOCKET_ERROR;
 		}
+#endif
 		return newSocket;
 	}
 }
\ No newline at end of file
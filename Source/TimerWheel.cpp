@@ -0,0 +1,173 @@
+/*
+*
+	DiscordCoreLoader, A stress-tester for Discord bot libraries, and Discord bots.
+
+	Copyright 2022 Chris M. (RealTimeChris)
+
+	This file is part of DiscordCoreLoader.
+	DiscordCoreLoader is free software: you can redistribute it and/or modify it under the terms of the GNU
+	General Public License as published by the Free Software Foundation, either version 3 of the License,
+	or (at your option) any later version.
+	DiscordCoreLoader is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+	even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License along with DiscordCoreLoader.
+	If not, see <https://www.gnu.org/licenses/>.
+
+*/
+/// TimerWheel.cpp - Source file for the per-agent hierarchical timer wheel.
+/// https://github.com/RealTimeChris/DiscordCoreLoader
+/// \file TimerWheel.cpp
+
+#include <discordcoreloader/TimerWheel.hpp>
+#include <algorithm>
+
+namespace DiscordCoreLoader {
+
+	bool TimerNode::isArmed() const noexcept {
+		return this->theWheel != nullptr;
+	}
+
+	void TimerNode::unlink() noexcept {
+		this->thePrevious->theNext = this->theNext;
+		this->theNext->thePrevious = this->thePrevious;
+		this->thePrevious = nullptr;
+		this->theNext = nullptr;
+	}
+
+	TimerNode::~TimerNode() noexcept {
+		if (this->theWheel) {
+			this->theWheel->cancel(*this);
+		}
+	}
+
+	TimerWheel::TimerWheel() noexcept {
+		this->theStartTime = std::chrono::steady_clock::now();
+		for (auto& theLevel: this->theSlots) {
+			for (auto& theSlot: theLevel) {
+				theSlot.thePrevious = &theSlot;
+				theSlot.theNext = &theSlot;
+			}
+		}
+		this->theExpired.thePrevious = &this->theExpired;
+		this->theExpired.theNext = &this->theExpired;
+	}
+
+	void TimerWheel::schedule(TimerNode& theTimer, std::chrono::milliseconds theDelay) noexcept {
+		if (theTimer.theWheel) {
+			theTimer.theWheel->cancel(theTimer);
+		}
+		auto theNowTick = std::max(this->getNowTick(), this->theCurrentTick);
+		theTimer.theDeadline = theNowTick + static_cast<uint64_t>(std::max<int64_t>(theDelay.count(), 0)) + 1;
+		theTimer.theWheel = this;
+		++this->theArmedCount;
+		this->insert(theTimer);
+	}
+
+	void TimerWheel::cancel(TimerNode& theTimer) noexcept {
+		if (theTimer.theWheel != this) {
+			return;
+		}
+		theTimer.unlink();
+		theTimer.theWheel = nullptr;
+		--this->theArmedCount;
+	}
+
+	void TimerWheel::advance() noexcept {
+		auto theNowTick = this->getNowTick();
+		while (this->theCurrentTick < theNowTick) {
+			++this->theCurrentTick;
+			for (uint64_t x = TimerWheel::theLevelCount - 1; x > 0; --x) {
+				if ((this->theCurrentTick & ((uint64_t{ 1 } << (TimerWheel::theSlotBits * x)) - 1)) == 0) {
+					this->cascade(x);
+				}
+			}
+			auto& theSlot = this->theSlots[0][this->theCurrentTick & (TimerWheel::theSlotCount - 1)];
+			while (theSlot.theNext != &theSlot) {
+				auto theTimer = theSlot.theNext;
+				theTimer->unlink();
+				theTimer->thePrevious = this->theExpired.thePrevious;
+				theTimer->theNext = &this->theExpired;
+				this->theExpired.thePrevious->theNext = theTimer;
+				this->theExpired.thePrevious = theTimer;
+			}
+		}
+		while (this->theExpired.theNext != &this->theExpired) {
+			auto theTimer = this->theExpired.theNext;
+			this->cancel(*theTimer);
+			if (theTimer->onExpired) {
+				theTimer->onExpired();
+			}
+		}
+	}
+
+	int32_t TimerWheel::getTimeoutInMs() noexcept {
+		if (this->theArmedCount == 0) {
+			return -1;
+		}
+		auto theNowTick = this->getNowTick();
+		if (theNowTick > this->theCurrentTick) {
+			return 0;
+		}
+		for (uint64_t x = 1; x < TimerWheel::theSlotCount; ++x) {
+			auto theTick = this->theCurrentTick + x;
+			if (auto& theSlot = this->theSlots[0][theTick & (TimerWheel::theSlotCount - 1)]; theSlot.theNext != &theSlot) {
+				return static_cast<int32_t>(x);
+			}
+			if ((theTick & (TimerWheel::theSlotCount - 1)) == 0) {
+				return static_cast<int32_t>(x);
+			}
+		}
+		return static_cast<int32_t>(TimerWheel::theSlotCount);
+	}
+
+	TimerWheel::~TimerWheel() noexcept {
+		for (auto& theLevel: this->theSlots) {
+			for (auto& theSlot: theLevel) {
+				while (theSlot.theNext != &theSlot) {
+					this->cancel(*theSlot.theNext);
+				}
+			}
+		}
+	}
+
+	uint64_t TimerWheel::getNowTick() noexcept {
+		return static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->theStartTime).count());
+	}
+
+	void TimerWheel::insert(TimerNode& theTimer) noexcept {
+		constexpr uint64_t theMaxDelta{ (uint64_t{ 1 } << (TimerWheel::theSlotBits * TimerWheel::theLevelCount)) - 1 };
+		theTimer.theDeadline = std::min(theTimer.theDeadline, this->theCurrentTick + theMaxDelta);
+		auto theDelta = theTimer.theDeadline - this->theCurrentTick;
+		uint64_t theLevel{ 0 };
+		while (theLevel < TimerWheel::theLevelCount - 1 && theDelta >= (uint64_t{ 1 } << (TimerWheel::theSlotBits * (theLevel + 1)))) {
+			++theLevel;
+		}
+		auto& theSlot = this->theSlots[theLevel][(theTimer.theDeadline >> (TimerWheel::theSlotBits * theLevel)) & (TimerWheel::theSlotCount - 1)];
+		theTimer.thePrevious = theSlot.thePrevious;
+		theTimer.theNext = &theSlot;
+		theSlot.thePrevious->theNext = &theTimer;
+		theSlot.thePrevious = &theTimer;
+	}
+
+	void TimerWheel::cascade(uint64_t theLevel) noexcept {
+		auto& theSlot = this->theSlots[theLevel][(this->theCurrentTick >> (TimerWheel::theSlotBits * theLevel)) & (TimerWheel::theSlotCount - 1)];
+		TimerNode theList{};
+		theList.thePrevious = &theList;
+		theList.theNext = &theList;
+		if (theSlot.theNext != &theSlot) {
+			theList.theNext = theSlot.theNext;
+			theList.thePrevious = theSlot.thePrevious;
+			theList.theNext->thePrevious = &theList;
+			theList.thePrevious->theNext = &theList;
+			theSlot.theNext = &theSlot;
+			theSlot.thePrevious = &theSlot;
+		}
+		while (theList.theNext != &theList) {
+			auto theTimer = theList.theNext;
+			theTimer->unlink();
+			this->insert(*theTimer);
+		}
+	}
+
+}
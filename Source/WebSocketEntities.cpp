@@ -21,6 +21,10 @@
 
 #include <discordcoreloader/WebSocketEntities.hpp>
 #include <discordcoreloader/DiscordCoreClient.hpp>
+#include <discordcoreloader/WireSerializer.hpp>
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+	#include <immintrin.h>
+#endif
 
 namespace DiscordCoreLoader {
 
@@ -32,8 +36,57 @@ namespace DiscordCoreLoader {
 	constexpr uint8_t webSocketFinishBit{ (1u << 7u) };
 	constexpr uint8_t webSocketMaskBit{ (1u << 7u) };
 
-	WebSocketSSLShard::WebSocketSSLShard(SOCKET theSocket, SSL_CTX* theContext, bool doWePrintErrorsNew, BaseSocketAgent* theAgentNew)
-		: SSLClient(theSocket, theContext, doWePrintErrorsNew) {
+	/// XORs a client-to-server payload with its 4-byte masking key, in place. Every vector step is a multiple of 4 bytes, so the key
+	/// stays aligned with the payload from one step to the next.
+	inline void unmaskPayload(char* theData, uint64_t theLength, const char* theMaskKey) noexcept {
+		uint32_t theMask{};
+		std::memcpy(&theMask, theMaskKey, sizeof(theMask));
+		uint64_t x{ 0 };
+#if defined(__AVX2__)
+		const __m256i theMask256{ _mm256_set1_epi32(static_cast<int32_t>(theMask)) };
+		for (; x + 32 <= theLength; x += 32) {
+			auto theValue = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(theData + x));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(theData + x), _mm256_xor_si256(theValue, theMask256));
+		}
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+		const __m128i theMask128{ _mm_set1_epi32(static_cast<int32_t>(theMask)) };
+		for (; x + 16 <= theLength; x += 16) {
+			auto theValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(theData + x));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(theData + x), _mm_xor_si128(theValue, theMask128));
+		}
+#endif
+		const uint64_t theMask64{ static_cast<uint64_t>(theMask) << 32 | theMask };
+		for (; x + 8 <= theLength; x += 8) {
+			uint64_t theValue{};
+			std::memcpy(&theValue, theData + x, sizeof(theValue));
+			theValue ^= theMask64;
+			std::memcpy(theData + x, &theValue, sizeof(theValue));
+		}
+		for (; x < theLength; ++x) {
+			theData[x] ^= theMaskKey[x & 3];
+		}
+	}
+
+	IdentifyRateLimiter::IdentifyRateLimiter(uint64_t maxConcurrencyNew, uint64_t intervalInMsNew) noexcept {
+		this->theBuckets.resize(maxConcurrencyNew > 0 ? maxConcurrencyNew : 1, std::chrono::steady_clock::time_point{});
+		this->theInterval = std::chrono::milliseconds{ intervalInMsNew };
+	}
+
+	bool IdentifyRateLimiter::tryAcquire(uint32_t theShard) noexcept {
+		std::lock_guard theLock{ this->theMutex };
+		auto& theBucket = this->theBuckets[theShard % this->theBuckets.size()];
+		auto theCurrentTime = std::chrono::steady_clock::now();
+		if (theBucket != std::chrono::steady_clock::time_point{} && theCurrentTime - theBucket < this->theInterval) {
+			return false;
+		}
+		theBucket = theCurrentTime;
+		return true;
+	}
+
+	WebSocketSSLShard::WebSocketSSLShard(SOCKET theSocket, SSL_CTX* theContext, TransportType theTransportNew, bool doWePrintErrorsNew,
+		BaseSocketAgent* theAgentNew)
+		: SSLClient(theSocket, theContext, theTransportNew, doWePrintErrorsNew) {
 		this->theAgent = theAgentNew;
 	}
 
@@ -42,13 +95,22 @@ namespace DiscordCoreLoader {
 	}
 
 	BaseSocketAgent::BaseSocketAgent(WebSocketSSLServerMain* webSocketSSLServerMainNew, DiscordCoreClient* discordCoreClient,
-		std::atomic_bool* doWeQuitNew, bool doWeInstantiateAThread) noexcept {
+		std::atomic_bool* doWeQuitNew, int32_t theWorkerIndexNew, bool doWeInstantiateAThread) noexcept
+		: theReactor{ discordCoreClient->configParser.getTheData().ioBackend } {
 		this->webSocketSSLServerMain = webSocketSSLServerMainNew;
 		this->discordCoreClient = discordCoreClient;
 		this->doWeQuit = doWeQuitNew;
+		this->theWorkerIndex = theWorkerIndexNew;
+		this->doWeUseNumaFirstTouch = discordCoreClient->configParser.getTheData().doWeUseNumaFirstTouch;
+		this->heartbeatInterval = static_cast<int32_t>(discordCoreClient->configParser.getTheData().heartbeatIntervalInMs);
+		this->heartbeatTimeout = this->heartbeatInterval + this->heartbeatInterval / 2;
+		this->maxFrameSize = discordCoreClient->configParser.getTheData().maxFrameSizeInBytes;
+		this->theEventRates = discordCoreClient->configParser.getTheData().eventRates;
 		this->jsonifier = discordCoreClient->configParser.getTheData();
 		if (doWeInstantiateAThread) {
+			this->buildEventTemplates();
 			this->theTask = std::make_unique<std::jthread>([this](std::stop_token theToken) {
+				this->pinToWorkerCpu();
 				this->run(theToken);
 			});
 		}
@@ -74,6 +136,71 @@ namespace DiscordCoreLoader {
 		}
 	}
 
+	void BaseSocketAgent::addShard(std::unique_ptr<WebSocketSSLShard> theShard) noexcept {
+		AgentCommand theCommand{};
+		theCommand.theType = AgentCommandType::Add_Shard;
+		theCommand.theShard = std::move(theShard);
+		this->theCommands.push(std::move(theCommand));
+		this->theReactor.wake();
+	}
+
+	void BaseSocketAgent::processCommands() noexcept {
+		AgentCommand theCommand{};
+		bool haveWeAddedShards{ false };
+		while (this->theCommands.tryPop(theCommand)) {
+			switch (theCommand.theType) {
+				case AgentCommandType::Add_Shard: {
+					auto& value = theCommand.theShard;
+					auto theCurrentShard = value->shard[0];
+					if (this->doWeUseNumaFirstTouch) {
+						value->inputBuffer.rehome();
+						value->outputChain.releaseFreeChunks();
+					}
+					if (this->theClients.contains(theCurrentShard)) {
+						this->theClients[theCurrentShard]->disconnect();
+					}
+					if (!this->theReactor.registerClient(value.get())) {
+						break;
+					}
+					this->theClients[theCurrentShard] = std::move(value);
+					this->armHeartbeatTimer(this->theClients[theCurrentShard].get());
+					this->startEventStreams(this->theClients[theCurrentShard].get());
+					this->sendFinalMessage(this->theClients[theCurrentShard].get());
+					haveWeAddedShards = true;
+					break;
+				}
+			}
+		}
+		if (haveWeAddedShards) {
+			this->activateShards();
+			this->currentClientSize = static_cast<int32_t>(this->theClients.size());
+		}
+	}
+
+	void BaseSocketAgent::pinToWorkerCpu() noexcept {
+		auto& theCpuList = this->discordCoreClient->configParser.getTheData().workerCpuList;
+		if (this->theWorkerIndex < 0 || theCpuList.size() == 0) {
+			return;
+		}
+		auto theCpu = theCpuList[static_cast<uint64_t>(this->theWorkerIndex) % theCpuList.size()];
+		bool didWePin{ false };
+#ifdef _WIN32
+		didWePin = theCpu < 64 && SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << theCpu) != 0;
+#else
+		if (theCpu < CPU_SETSIZE) {
+			cpu_set_t theCpuSet{};
+			CPU_ZERO(&theCpuSet);
+			CPU_SET(theCpu, &theCpuSet);
+			didWePin = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &theCpuSet) == 0;
+		}
+#endif
+		if (!didWePin && this->discordCoreClient->configParser.getTheData().doWePrintGeneralErrorMessages) {
+			std::unique_lock theLock{ this->discordCoreClient->coutMutex };
+			std::cout << shiftToBrightRed() << "Failed to pin agent " << this->theWorkerIndex << " to CPU " << theCpu << ", so it stays unpinned."
+					  << reset() << std::endl;
+		}
+	}
+
 	std::jthread* BaseSocketAgent::getTheTask() noexcept {
 		return this->theTask.get();
 	}
@@ -137,6 +264,7 @@ namespace DiscordCoreLoader {
 
 	void BaseSocketAgent::sendResumedPayload(SSLClient* theShard) noexcept {
 		theShard->lastNumberSent++;
+		ArenaScope theScope{ this->theMessageArena };
 		Jsonifier jsonData{};
 		jsonData["op"] = static_cast<int8_t>(0);
 		jsonData["s"] = theShard->lastNumberSent;
@@ -149,61 +277,112 @@ namespace DiscordCoreLoader {
 		this->sendMessage(std::move(jsonData), theShard->theOpCode, theShard, true);
 	}
 
-	void BaseSocketAgent::generateGuildData() noexcept {
+	void BaseSocketAgent::activateShards() noexcept {
 		for (auto& [key, value]: this->theClients) {
-			std::string theString{};
-			if (!value->doWeHaveOurGuild) {
-				this->jsonifier.randomizeId(theString);
-				value->theGuildHolder["d"] = this->jsonifier.JSONIFYGuild(std::move(*this->jsonifier.generateGuild(theString)));
-				value->theGuildHolder["op"] = static_cast<int8_t>(0);
-				value->theGuildHolder["t"] = "GUILD_CREATE";
-				value->doWeHaveOurGuild = true;
-			}
+			this->theActiveShards.emplace(key);
 		}
 	}
 
 	void BaseSocketAgent::sendCreateGuilds(SSLClient* theShard) noexcept {
-		if (theShard->currentGuildCount < theShard->totalGuildCount && theShard->doWeHaveOurGuild) {
+		if (theShard->currentGuildCount < theShard->totalGuildCount) {
+			// Each shard walks the whole pool from its own starting slot, so that its guilds differ, and the same Seed sends the same ones.
+			auto theSlot = static_cast<uint64_t>(theShard->shard[0]) + static_cast<uint64_t>(theShard->currentGuildCount);
+			auto& theTemplate = this->discordCoreClient->guildCorpus->getTemplate(theSlot, theShard->theMode);
+			if (theTemplate.theBytes.size() == 0) {
+				// Clearing sendGuilds lets the shard drop out of the active set, instead of coming back here on every loop iteration.
+				if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+					std::lock_guard<std::mutex> theLock{ this->discordCoreClient->coutMutex };
+					std::cout << shiftToBrightRed() << "Shard " << theShard->shard[0]
+							  << "'s GUILD_CREATE template is empty, so it sends no more guilds." << reset() << std::endl
+							  << std::endl;
+				}
+				theShard->sendGuilds = false;
+				return;
+			}
 			theShard->currentGuildCount++;
 			theShard->lastNumberSent++;
-			for (auto& value: theShard->theGuildHolder["d"]["roles"].getValue<Jsonifier::ArrayType>()) {
-				std::string theString{};
-				this->jsonifier.randomizeId(theString);
-				value["id"] = std::move(theString);
-			}
-			for (auto& value: theShard->theGuildHolder["d"]["members"].getValue<Jsonifier::ArrayType>()) {
-				std::string theString{};
-				this->jsonifier.randomizeId(theString);
-				value["user"]["id"] = std::move(theString);
-			}
-			for (auto& value: theShard->theGuildHolder["d"]["channels"].getValue<Jsonifier::ArrayType>()) {
-				std::string theString{};
-				this->jsonifier.randomizeId(theString);
-				value["id"] = std::move(theString);
-			}
-			std::string theString{};
-			this->jsonifier.randomizeId(theString);
-			theShard->theGuildHolder["d"]["id"] = theString;
-			theShard->theGuildHolder["s"] = theShard->lastNumberSent;
-			theShard->theGuildHolder["t"] = "GUILD_CREATE";
-			WebSocketMessage theMessage{};
 			if (theShard->theMode == WebSocketMode::JSON) {
 				theShard->theOpCode = WebSocketOpCode::Op_Text;
 			} else {
 				theShard->theOpCode = WebSocketOpCode::Op_Binary;
 			}
-			theMessage.jsonMsg = theShard->theGuildHolder;
+
+			WebSocketMessage theMessage{};
+			theMessage.theTemplate = &theTemplate;
 			theMessage.theOpCode = theShard->theOpCode;
+			theMessage.theSequence = theShard->lastNumberSent;
+			theMessage.theIds.resize(theTemplate.theGroupCount * theTemplate.theIdLength);
+			this->jsonifier.seedStream(theShard->shard[0], static_cast<uint64_t>(SeedStream::Guild_Create) + theShard->currentGuildCount);
+			std::string theId{};
+			for (uint64_t x = 0; x < theTemplate.theGroupCount; ++x) {
+				this->jsonifier.randomizeId(theId);
+				std::memcpy(theMessage.theIds.data() + x * theTemplate.theIdLength, theId.data(), theTemplate.theIdLength);
+			}
 			theShard->theMessageQueue.emplace_back(std::move(theMessage));
 		}
 	}
 
+	void BaseSocketAgent::createSequence(std::string& outBuffer, int64_t theSequence, WebSocketOpCode opCodeNew) noexcept {
+		if (opCodeNew == WebSocketOpCode::Op_Text) {
+			outBuffer = "\"s\":" + std::to_string(theSequence) + ",";
+		} else {
+			char theKey[6]{ static_cast<int8_t>(EtfType::Binary_Ext) };
+			storeBits(theKey + 1, uint32_t{ 1 });
+			theKey[5] = 's';
+			outBuffer.append(theKey, std::size(theKey));
+			char theValue[5]{ static_cast<int8_t>(EtfType::Integer_Ext) };
+			storeBits(theValue + 1, static_cast<int32_t>(theSequence));
+			outBuffer.append(theValue, std::size(theValue));
+		}
+	}
+
+	void BaseSocketAgent::renderGuildCreate(const WebSocketMessage& theMessage, SSLClient* theShard) noexcept {
+		try {
+			auto& theTemplate = *theMessage.theTemplate;
+			std::string theSequence{};
+			this->createSequence(theSequence, theMessage.theSequence, theMessage.theOpCode);
+
+			auto thePayloadSize = theTemplate.theBytes.size() + theSequence.size();
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketSuccessSentMessages) {
+				std::lock_guard<std::mutex> theLock{ this->discordCoreClient->coutMutex };
+				std::cout << shiftToBrightBlue() << "Sending WebSocket " + std::to_string(theShard->shard[0]) + std::string("'s Message: ")
+						  << "GUILD_CREATE (" << thePayloadSize << " bytes)" << reset() << std::endl;
+			}
+			if (this->webSocketSSLServerMain == nullptr || !theShard->hasTransport()) {
+				return;
+			}
+			std::string theHeader{};
+			this->createHeader(theHeader, thePayloadSize, theMessage.theOpCode);
+			auto& theChain = theShard->outputChain;
+			theChain.append(theHeader.data(), theHeader.size());
+			theChain.markFrame();
+			theChain.append(theTemplate.theBytes.data(), theTemplate.theInsertOffset);
+			theChain.append(theSequence.data(), theSequence.size());
+			theChain.append(theTemplate.theBytes.data() + theTemplate.theInsertOffset, theTemplate.theBytes.size() - theTemplate.theInsertOffset);
+			uint64_t theOffsetIndex{};
+			for (uint64_t x = 0; x < theTemplate.theGroupCount; ++x) {
+				auto theId = theMessage.theIds.data() + x * theTemplate.theIdLength;
+				for (; theOffsetIndex < theTemplate.theGroupEnds[x]; ++theOffsetIndex) {
+					theChain.patch(theTemplate.theOffsets[theOffsetIndex] + theSequence.size(), theId, theTemplate.theIdLength);
+				}
+			}
+			theShard->updateWriteInterest();
+		} catch (...) {
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+				reportException("BaseSocketAgent::renderGuildCreate()");
+			}
+			theShard->disconnect();
+		}
+	}
+
 	void BaseSocketAgent::sendReadyMessage(SSLClient* theShard) noexcept {
 		theShard->lastNumberSent++;
+		ArenaScope theScope{ this->theMessageArena };
 		Jsonifier jsonData{};
 		jsonData["op"] = static_cast<int8_t>(0);
 		jsonData["s"] = theShard->lastNumberSent;
 		jsonData["t"] = "READY";
+		this->jsonifier.seedStream(theShard->shard[0], static_cast<uint64_t>(SeedStream::Ready));
 		std::string theString{};
 		this->jsonifier.randomizeId(theString);
 		jsonData["d"]["session_id"] = std::move(theString);
@@ -226,9 +405,23 @@ namespace DiscordCoreLoader {
 	}
 
 	void BaseSocketAgent::sendHelloMessage(SSLClient* theShard) noexcept {
+		ArenaScope theScope{ this->theMessageArena };
 		Jsonifier jsonData{};
 		jsonData["op"] = static_cast<int8_t>(10);
-		jsonData["d"]["heartbeat_interval"] = static_cast<uint16_t>(this->heartbeatInterval);
+		jsonData["d"]["heartbeat_interval"] = static_cast<int64_t>(this->heartbeatInterval);
+		if (theShard->theMode == WebSocketMode::JSON) {
+			theShard->theOpCode = WebSocketOpCode::Op_Text;
+		} else {
+			theShard->theOpCode = WebSocketOpCode::Op_Binary;
+		}
+		this->sendMessage(std::move(jsonData), theShard->theOpCode, theShard, true);
+	}
+
+	void BaseSocketAgent::sendInvalidSession(SSLClient* theShard) noexcept {
+		ArenaScope theScope{ this->theMessageArena };
+		Jsonifier jsonData{};
+		jsonData["op"] = static_cast<int8_t>(9);
+		jsonData["d"] = false;
 		if (theShard->theMode == WebSocketMode::JSON) {
 			theShard->theOpCode = WebSocketOpCode::Op_Text;
 		} else {
@@ -238,6 +431,7 @@ namespace DiscordCoreLoader {
 	}
 
 	void BaseSocketAgent::sendHeartBeat(SSLClient* theShard) noexcept {
+		ArenaScope theScope{ this->theMessageArena };
 		Jsonifier jsonData{};
 		jsonData["op"] = static_cast<int8_t>(11);
 		jsonData["d"] = theShard->lastNumberSent;
@@ -294,6 +488,284 @@ namespace DiscordCoreLoader {
 		}
 	}
 
+	void BaseSocketAgent::armHeartbeatTimer(WebSocketSSLShard* theShard) noexcept {
+		if (!theShard->theHeartbeatTimer.onExpired) {
+			theShard->theHeartbeatTimer.onExpired = [this, theShard] {
+				this->onHeartbeatTimeout(theShard);
+			};
+		}
+		this->theTimers.schedule(theShard->theHeartbeatTimer, std::chrono::milliseconds{ this->heartbeatTimeout });
+	}
+
+	void BaseSocketAgent::onHeartbeatTimeout(WebSocketSSLShard* theShard) noexcept {
+		if (!theShard->areWeStillConnected()) {
+			return;
+		}
+		if (theShard->haveWeTimedOut) {
+			theShard->disconnect();
+			return;
+		}
+		if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+			std::unique_lock theLock{ this->discordCoreClient->coutMutex };
+			std::cout << shiftToBrightRed() << "WebSocket [" << theShard->shard[0] << "," << theShard->shard[1]
+					  << "] missed its heartbeat, closing it with Session_Timed_Out." << reset() << std::endl
+					  << std::endl;
+		}
+		theShard->haveWeTimedOut = true;
+		this->initDisconnect(WebSocketCloseCode::Session_Timed_Out, theShard);
+		this->theActiveShards.emplace(theShard->shard[0]);
+		this->theTimers.schedule(theShard->theHeartbeatTimer, std::chrono::milliseconds{ BaseSocketAgent::closeGraceInMs });
+	}
+
+	void BaseSocketAgent::startEventStreams(WebSocketSSLShard* theShard) noexcept {
+		theShard->theEventStart = std::chrono::steady_clock::now();
+		for (auto& value: this->theEventRates) {
+			bool doWeHaveArrivals = value.ratePerSecond > 0.0 || value.rampToRatePerSecond > 0.0;
+			bool doWeHaveBursts = value.burstSize > 0 && value.burstPeriodInMs > 0;
+			if (!doWeHaveArrivals && !doWeHaveBursts) {
+				continue;
+			}
+			auto& theStream = theShard->theEventStreams.emplace_back();
+			theStream.theRate = &value;
+			if (doWeHaveArrivals) {
+				theStream.theNextArrival = theShard->theEventStart;
+				this->advanceArrival(theShard, theStream);
+				theStream.theArrivalTimer.onExpired = [this, theShard, &theStream] {
+					this->onEventArrival(theShard, theStream);
+				};
+				this->theTimers.schedule(theStream.theArrivalTimer,
+					std::chrono::ceil<std::chrono::milliseconds>(theStream.theNextArrival - theShard->theEventStart));
+			}
+			if (doWeHaveBursts) {
+				theStream.theNextBurst = theShard->theEventStart + std::chrono::milliseconds{ value.burstPeriodInMs };
+				theStream.theBurstTimer.onExpired = [this, theShard, &theStream] {
+					this->onEventBurst(theShard, theStream);
+				};
+				this->theTimers.schedule(theStream.theBurstTimer, std::chrono::milliseconds{ value.burstPeriodInMs });
+			}
+		}
+	}
+
+	void BaseSocketAgent::advanceArrival(WebSocketSSLShard* theShard, EventStream& theStream) noexcept {
+		auto& theRate = *theStream.theRate;
+		auto theElapsedInMs = std::chrono::duration<double, std::milli>(theStream.theNextArrival - theShard->theEventStart).count();
+		double theRatePerSecond{ theRate.rampToRatePerSecond };
+		if (theElapsedInMs < static_cast<double>(theRate.rampDurationInMs)) {
+			auto theFraction = theElapsedInMs / static_cast<double>(theRate.rampDurationInMs);
+			if (theRate.rampSteps > 0) {
+				theFraction = std::floor(theFraction * static_cast<double>(theRate.rampSteps)) / static_cast<double>(theRate.rampSteps);
+			}
+			theRatePerSecond = theRate.ratePerSecond + (theRate.rampToRatePerSecond - theRate.ratePerSecond) * theFraction;
+		}
+		if (theRatePerSecond <= 0.0) {
+			theStream.theNextArrival += BaseSocketAgent::idleRateRecheck;
+			theStream.isItAnArrival = false;
+			return;
+		}
+		double theGapInSeconds{ 1.0 / theRatePerSecond };
+		if (theRate.theArrivals == ArrivalProcess::Poisson) {
+			theGapInSeconds = this->jsonifier.randomizeExponential(theRatePerSecond);
+		}
+		theStream.theNextArrival += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>{ theGapInSeconds });
+		theStream.isItAnArrival = true;
+	}
+
+	void BaseSocketAgent::onEventArrival(WebSocketSSLShard* theShard, EventStream& theStream) noexcept {
+		if (!theShard->areWeStillConnected() || theShard->haveWeTimedOut) {
+			return;
+		}
+		auto theNow = std::chrono::steady_clock::now();
+		while (theStream.theNextArrival <= theNow) {
+			if (theStream.isItAnArrival) {
+				this->queueEvent(theShard, theStream.theRate->theEvent, theStream.theNextArrival);
+			}
+			this->advanceArrival(theShard, theStream);
+		}
+		this->theTimers.schedule(theStream.theArrivalTimer, std::chrono::ceil<std::chrono::milliseconds>(theStream.theNextArrival - theNow));
+	}
+
+	void BaseSocketAgent::onEventBurst(WebSocketSSLShard* theShard, EventStream& theStream) noexcept {
+		if (!theShard->areWeStillConnected() || theShard->haveWeTimedOut) {
+			return;
+		}
+		auto theNow = std::chrono::steady_clock::now();
+		while (theStream.theNextBurst <= theNow) {
+			for (uint64_t x = 0; x < theStream.theRate->burstSize; ++x) {
+				this->queueEvent(theShard, theStream.theRate->theEvent, theStream.theNextBurst);
+			}
+			theStream.theNextBurst += std::chrono::milliseconds{ theStream.theRate->burstPeriodInMs };
+		}
+		this->theTimers.schedule(theStream.theBurstTimer, std::chrono::ceil<std::chrono::milliseconds>(theStream.theNextBurst - theNow));
+	}
+
+	void BaseSocketAgent::queueEvent(WebSocketSSLShard* theShard, GatewayEventType theEvent,
+		std::chrono::steady_clock::time_point theIntendedTime) noexcept {
+		auto theOffset = std::chrono::duration_cast<std::chrono::microseconds>(theIntendedTime - std::chrono::steady_clock::now());
+		WebSocketMessage theMessage{};
+		theMessage.theEventType = theEvent;
+		theMessage.theOpCode = theShard->theMode == WebSocketMode::JSON ? WebSocketOpCode::Op_Text : WebSocketOpCode::Op_Binary;
+		theMessage.theSequence = ++theShard->lastNumberSent;
+		theMessage.theIntendedTimeInUs =
+			std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count() + theOffset.count();
+		theShard->theMessageQueue.emplace_back(std::move(theMessage));
+		this->theActiveShards.emplace(theShard->shard[0]);
+	}
+
+	void BaseSocketAgent::buildEventTemplates() noexcept {
+		try {
+			this->jsonifier.seedStream(static_cast<uint64_t>(this->theWorkerIndex), static_cast<uint64_t>(SeedStream::Event_Template));
+			for (auto& value: this->theEventRates) {
+				for (auto theMode: { WebSocketMode::JSON, WebSocketMode::ETF }) {
+					auto theKey = static_cast<uint64_t>(value.theEvent) * 2 + static_cast<uint64_t>(theMode);
+					if (this->theEventTemplates.contains(theKey)) {
+						continue;
+					}
+					auto& theTemplates = this->theEventTemplates[theKey];
+					for (uint64_t x = 0; x < BaseSocketAgent::eventTemplateVariants; ++x) {
+						EventTemplate theTemplate{};
+						if (this->buildEventTemplate(theTemplate, value.theEvent, theMode)) {
+							theTemplates.emplace_back(std::move(theTemplate));
+						}
+					}
+				}
+			}
+		} catch (...) {
+			if (this->discordCoreClient->configParser.getTheData().doWePrintGeneralErrorMessages) {
+				reportException("BaseSocketAgent::buildEventTemplates()");
+			}
+		}
+	}
+
+	bool BaseSocketAgent::buildEventTemplate(EventTemplate& theTemplate, GatewayEventType theEvent, WebSocketMode theMode) {
+		auto theType = theMode == WebSocketMode::JSON ? JsonifierSerializeType::Json : JsonifierSerializeType::Etf;
+		std::string theChannelId{};
+		std::string theGuildId{};
+		std::string theId{};
+		this->jsonifier.randomizeId(theChannelId);
+		this->jsonifier.randomizeId(theGuildId);
+		this->jsonifier.randomizeId(theId);
+		if (theChannelId.size() != Randomizer::idLength || theGuildId.size() != Randomizer::idLength || theId.size() != Randomizer::idLength) {
+			return false;
+		}
+		// The ids take groups 0 to 2, and the nonce or the timestamp takes group 3.
+		WireIdRecorder theIdRecorder{};
+		theIdRecorder.theOffsets.resize(4);
+		theIdRecorder.theGroupIndices.emplace(theChannelId, 0);
+		theIdRecorder.theGroupIndices.emplace(theGuildId, 1);
+		theIdRecorder.theGroupIndices.emplace(theId, 2);
+		switch (theEvent) {
+			case GatewayEventType::Message_Create: {
+				auto theAuthor = this->jsonifier.generateUser();
+				WireMessageCreate theData{};
+				theData.author = theAuthor.get();
+				theData.channelId = theChannelId;
+				theData.content = this->jsonifier.generateContent();
+				theData.guildId = theGuildId;
+				theData.id = theId;
+				theData.nonce = std::string(Randomizer::idLength, '0');
+				theData.timestamp = this->jsonifier.generateTimestamp();
+				theIdRecorder.theGroupIndices.emplace(theData.nonce, 3);
+				WireDispatch<WireMessageCreate> thePayload{ &theData, 0, "MESSAGE_CREATE" };
+				WireSerializer{ theTemplate.theBytes, theType, &theIdRecorder }.serialize(thePayload);
+				break;
+			}
+			case GatewayEventType::Typing_Start: {
+				WireTypingStart theData{};
+				theData.channelId = theChannelId;
+				theData.guildId = theGuildId;
+				theData.timestamp = std::clamp<int64_t>(std::time(nullptr), 1000000000, INT32_MAX);
+				theData.userId = theId;
+				theIdRecorder.theIntegerGroupIndices.emplace(theData.timestamp, 3);
+				WireDispatch<WireTypingStart> thePayload{ &theData, 0, "TYPING_START" };
+				WireSerializer{ theTemplate.theBytes, theType, &theIdRecorder }.serialize(thePayload);
+				break;
+			}
+			default: {
+				return false;
+			}
+		}
+		for (auto& value: theIdRecorder.theOffsets) {
+			if (value.size() != 1) {
+				return false;
+			}
+		}
+		if (!reserveSequenceSlot(theTemplate.theBytes, theType, theTemplate.theInsertOffset)) {
+			return false;
+		}
+		theTemplate.theIdOffsets = { theIdRecorder.theOffsets[0][0], theIdRecorder.theOffsets[1][0], theIdRecorder.theOffsets[2][0] };
+		if (theEvent == GatewayEventType::Message_Create) {
+			theTemplate.theNonceOffset = theIdRecorder.theOffsets[3][0];
+		} else {
+			theTemplate.theUnixTimeOffset = theIdRecorder.theOffsets[3][0];
+		}
+		return true;
+	}
+
+	void BaseSocketAgent::renderEvent(const WebSocketMessage& theMessage, SSLClient* theShard) noexcept {
+		try {
+			auto theTemplates =
+				this->theEventTemplates.find(static_cast<uint64_t>(theMessage.theEventType) * 2 + static_cast<uint64_t>(theShard->theMode));
+			if (theTemplates == this->theEventTemplates.end() || theTemplates->second.size() == 0) {
+				return;
+			}
+			auto& theTemplate = theTemplates->second[this->jsonifier.randomize64BitUInt(uint64_t{ 0 }, theTemplates->second.size() - 1)];
+			std::string theSequence{};
+			this->createSequence(theSequence, theMessage.theSequence, theMessage.theOpCode);
+
+			auto thePayloadSize = theTemplate.theBytes.size() + theSequence.size();
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketSuccessSentMessages) {
+				std::lock_guard<std::mutex> theLock{ this->discordCoreClient->coutMutex };
+				std::cout << shiftToBrightBlue() << "Sending WebSocket " + std::to_string(theShard->shard[0]) + std::string("'s Message: ")
+						  << (theMessage.theEventType == GatewayEventType::Message_Create ? "MESSAGE_CREATE" : "TYPING_START") << " ("
+						  << thePayloadSize << " bytes)" << reset() << std::endl;
+			}
+			if (this->webSocketSSLServerMain == nullptr || !theShard->hasTransport()) {
+				return;
+			}
+			std::string theHeader{};
+			this->createHeader(theHeader, thePayloadSize, theMessage.theOpCode);
+			auto& theChain = theShard->outputChain;
+			theChain.append(theHeader.data(), theHeader.size());
+			theChain.markFrame();
+			theChain.append(theTemplate.theBytes.data(), theTemplate.theInsertOffset);
+			theChain.append(theSequence.data(), theSequence.size());
+			theChain.append(theTemplate.theBytes.data() + theTemplate.theInsertOffset, theTemplate.theBytes.size() - theTemplate.theInsertOffset);
+			std::string theId{};
+			for (auto& value: theTemplate.theIdOffsets) {
+				this->jsonifier.randomizeId(theId);
+				theChain.patch(value + theSequence.size(), theId.data(), Randomizer::idLength);
+			}
+			char theDigits[24]{};
+			if (theTemplate.theNonceOffset > 0) {
+				auto theResult = std::to_chars(theDigits, theDigits + std::size(theDigits), theMessage.theIntendedTimeInUs);
+				auto theLength = static_cast<uint64_t>(theResult.ptr - theDigits);
+				if (theLength <= Randomizer::idLength) {
+					std::string theNonce(Randomizer::idLength - theLength, '0');
+					theNonce.append(theDigits, theLength);
+					theChain.patch(theTemplate.theNonceOffset + theSequence.size(), theNonce.data(), theNonce.size());
+				}
+			}
+			if (theTemplate.theUnixTimeOffset > 0) {
+				auto theUnixTime = theMessage.theIntendedTimeInUs / 1000000;
+				if (theMessage.theOpCode == WebSocketOpCode::Op_Text) {
+					auto theResult = std::to_chars(theDigits, theDigits + std::size(theDigits), theUnixTime);
+					if (theResult.ptr - theDigits == 10) {
+						theChain.patch(theTemplate.theUnixTimeOffset + theSequence.size(), theDigits, 10);
+					}
+				} else if (std::in_range<int32_t>(theUnixTime)) {
+					storeBits(theDigits, static_cast<int32_t>(theUnixTime));
+					theChain.patch(theTemplate.theUnixTimeOffset + theSequence.size(), theDigits, sizeof(int32_t));
+				}
+			}
+			theShard->updateWriteInterest();
+		} catch (...) {
+			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+				reportException("BaseSocketAgent::renderEvent()");
+			}
+			theShard->disconnect();
+		}
+	}
+
 	void BaseSocketAgent::initDisconnect(WebSocketCloseCode reason, SSLClient* theShard) noexcept {
 		if (theShard != 0) {
 			std::string theString{};
@@ -307,66 +779,100 @@ namespace DiscordCoreLoader {
 			WebSocketMessage theMessage{};
 			theMessage.stringMsg = theString;
 			theMessage.theOpCode = WebSocketOpCode::Op_Close;
-			theShard->theMessageQueue.push_front(theMessage);
+			theShard->theMessageQueue.push_front(std::move(theMessage));
 		}
 	}
 
 	void BaseSocketAgent::sendFinalMessage(SSLClient* theShard) noexcept {
-		if (theShard->outputBuffers.size() == 0) {
-			if (theShard->theMessageQueue.size() > 0) {
-				WebSocketMessage newMessage = std::move(theShard->theMessageQueue.front());
-				theShard->theMessageQueue.pop_front();
-				if (newMessage.stringMsg.size() > 0) {
-					this->sendMessage(&newMessage.stringMsg, theShard, false);
-				} else {
-					this->sendMessage(std::move(newMessage.jsonMsg), newMessage.theOpCode, theShard, false);
+		// Render queued frames into the chain until it holds about one write budget, and then write them all in one pass.
+		while (theShard->outputChain.size() < SSLClient::maxWriteBudget && theShard->areWeStillConnected()) {
+			if (theShard->theMessageQueue.size() == 0) {
+				if (!theShard->sendGuilds || theShard->currentGuildCount >= theShard->totalGuildCount) {
+					break;
 				}
+				this->sendCreateGuilds(theShard);
+				if (theShard->theMessageQueue.size() == 0) {
+					break;
+				}
+			}
+			WebSocketMessage newMessage = std::move(theShard->theMessageQueue.front());
+			theShard->theMessageQueue.pop_front();
+			if (newMessage.theTemplate) {
+				this->renderGuildCreate(newMessage, theShard);
+			} else if (newMessage.theEventType != GatewayEventType::None) {
+				this->renderEvent(newMessage, theShard);
+			} else if (newMessage.stringMsg.size() > 0) {
+				this->sendMessage(&newMessage.stringMsg, theShard, false);
 			}
+			if (newMessage.theOpCode == WebSocketOpCode::Op_Close) {
+				theShard->sendGuilds = false;
+				break;
+			}
+		}
+		if (theShard->outputChain.size() > 0 && theShard->areWeStillConnected()) {
+			theShard->writeDataProcess();
 		}
 	}
 
 	void BaseSocketAgent::run(std::stop_token theToken) noexcept {
 		try {
+			std::stop_callback theStopCallback{ theToken, [this] {
+				this->theReactor.wake();
+			} };
+			std::chrono::microseconds theBusyPollBudget{ this->discordCoreClient->configParser.getTheData().busyPollBudgetInUs };
+			auto theLastBusyTime = std::chrono::steady_clock::now();
 			while (!theToken.stop_requested() && !this->doWeQuit->load()) {
-				if (this->theClients.size() > 0) {
-					std::vector<WebSocketSSLShard*> theVector{};
-					for (auto& [key, value]: this->theClients) {
-						if (value && value->areWeStillConnected() && value->areWeConnected) {
-							theVector.emplace_back(value.get());
-						}
-					}
-					if (theVector.size() == 0) {
-						std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+				this->processCommands();
+				this->theTimers.advance();
+				if (this->theClients.size() > this->currentClientSize) {
+					this->activateShards();
+					this->currentClientSize = static_cast<int32_t>(this->theClients.size());
+				}
+				bool isThereRunnableWork{ false };
+				for (auto iterator = this->theActiveShards.begin(); iterator != this->theActiveShards.end();) {
+					auto key = *iterator;
+					if (key == -1 || !this->theClients.contains(key) || !this->theClients[key] || !this->theClients[key]->areWeStillConnected()) {
+						iterator = this->theActiveShards.erase(iterator);
+						continue;
 					}
-					theVector = this->webSocketSSLServerMain->processIO(theVector);
-					for (auto& value: theVector) {
-						if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
-							std::unique_lock theLockTwo{ this->discordCoreClient->coutMutex };
-							std::cout << shiftToBrightRed() << "Connection lost for WebSocket [" << std::to_string(value->shard[0]) << ","
-									  << this->discordCoreClient->totalShardCount.load() << "]... reconnecting." << reset() << std::endl
-									  << std::endl;
-						}
-						value->disconnect();
+					auto& value = this->theClients[key];
+					if (this->closeCode == 0) {
+						this->sendFinalMessage(value.get());
+					} else {
+						this->closeCode = 0;
+						isThereRunnableWork = true;
+						break;
 					}
-					if (this->theClients.size() > this->currentClientSize) {
-						this->generateGuildData();
-						this->currentClientSize = static_cast<int32_t>(this->theClients.size());
+					if (value->theMessageQueue.size() == 0 && (!value->sendGuilds || value->currentGuildCount >= value->totalGuildCount)) {
+						iterator = this->theActiveShards.erase(iterator);
+					} else {
+						isThereRunnableWork = isThereRunnableWork || value->outputChain.size() < SSLClient::maxWriteBudget;
+						++iterator;
 					}
-					for (auto& [key, value]: this->theClients) {
-						if (value && key != -1) {
-							if (this->closeCode == 0) {
-								if (value->outputBuffers.size() == 0) {
-									if (value->sendGuilds) {
-										this->sendCreateGuilds(value.get());
-									}
-									this->sendFinalMessage(value.get());
-								}
-							} else {
-								this->closeCode = 0;
-								break;
-							}
-						}
+				}
+				int32_t theTimeout{ BaseSocketAgent::maxIdleWaitInMs };
+				if (auto theTimerTimeout = this->theTimers.getTimeoutInMs(); theTimerTimeout >= 0) {
+					theTimeout = std::min(theTimeout, theTimerTimeout);
+				}
+				if (isThereRunnableWork || std::chrono::steady_clock::now() - theLastBusyTime < theBusyPollBudget) {
+					theTimeout = 0;
+				}
+				std::vector<SSLClient*> theReadyClients{};
+				auto theVector = this->theReactor.processIO(theTimeout, &theReadyClients);
+				if (theBusyPollBudget.count() > 0 && (theReadyClients.size() > 0 || theVector.size() > 0)) {
+					theLastBusyTime = std::chrono::steady_clock::now();
+				}
+				for (auto& value: theVector) {
+					if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
+						std::unique_lock theLockTwo{ this->discordCoreClient->coutMutex };
+						std::cout << shiftToBrightRed() << "Connection lost for WebSocket [" << std::to_string(value->shard[0]) << ","
+								  << this->discordCoreClient->totalShardCount.load() << "]... reconnecting." << reset() << std::endl
+								  << std::endl;
 					}
+					value->disconnect();
+				}
+				for (auto& value: theReadyClients) {
+					this->theActiveShards.emplace(value->shard[0]);
 				}
 			}
 		} catch (...) {
@@ -396,10 +902,9 @@ namespace DiscordCoreLoader {
 	void BaseSocketAgent::sendGuildMemberChunks(SSLClient*) noexcept {
 	}
 
-	void BaseSocketAgent::onMessageReceived(WebSocketSSLShard* theShard, std::string& theString) noexcept {
+	void BaseSocketAgent::onMessageReceived(WebSocketSSLShard* theShard, std::string_view theString, uint64_t thePaddedSize) noexcept {
 		try {
-			std::string refString{};
-			std::string& payload{ refString };
+			std::string_view payload{};
 			bool returnValue{ false };
 
 			simdjson::ondemand::value thePayload{};
@@ -409,10 +914,12 @@ namespace DiscordCoreLoader {
 
 				if (theShard->theOpCode == WebSocketOpCode::Op_Binary) {
 					try {
-						payload = ErlParser::parseEtfToJson(theString);
-						payload.reserve(payload.size() + simdjson::SIMDJSON_PADDING);
+						std::string& theJsonString = ErlParser::parseEtfToJson(theString);
+						theJsonString.reserve(theJsonString.size() + simdjson::SIMDJSON_PADDING);
+						payload = theJsonString;
 						simdjson::ondemand::value theValue{};
-						if (this->theParser.iterate(simdjson::padded_string_view(payload.data(), payload.length(), payload.capacity()))
+						if (this->theParser
+								.iterate(simdjson::padded_string_view(theJsonString.data(), theJsonString.length(), theJsonString.capacity()))
 								.get(theValue) == simdjson::error_code::SUCCESS) {
 							theMessage = WebSocketMessageReal{ theValue };
 						}
@@ -422,9 +929,8 @@ namespace DiscordCoreLoader {
 					}
 				} else {
 					payload = theString;
-					payload.reserve(payload.size() + simdjson::SIMDJSON_PADDING);
 					simdjson::ondemand::value theValue{};
-					if (this->theParser.iterate(simdjson::padded_string_view(payload.data(), payload.length(), payload.capacity())).get(theValue) ==
+					if (this->theParser.iterate(simdjson::padded_string_view(payload.data(), payload.length(), thePaddedSize)).get(theValue) ==
 						simdjson::error_code::SUCCESS) {
 						theMessage = WebSocketMessageReal{ theValue };
 					}
@@ -436,24 +942,25 @@ namespace DiscordCoreLoader {
 				}
 				switch (theMessage.op) {
 					case 1: {
+						if (theShard->theHeartbeatTimer.isArmed() && !theShard->haveWeTimedOut) {
+							this->armHeartbeatTimer(theShard);
+						}
 						this->sendHeartBeat(theShard);
-						theShard->getInputBuffer().clear();
 						break;
 					}
 					case 2: {
 						WebSocketIdentifyData identifyData{ theMessage.d };
-						if (!this->discordCoreClient->haveWeCollectedShardingInfo) {
-							this->discordCoreClient->haveWeCollectedShardingInfo = true;
+						if (!this->discordCoreClient->identifyRateLimiter->tryAcquire(identifyData.shard[0])) {
+							this->sendInvalidSession(theShard);
+							break;
+						}
+						if (!this->discordCoreClient->haveWeCollectedShardingInfo.exchange(true)) {
 							this->discordCoreClient->shardingOptions.startingShard = identifyData.shard[0];
 							this->discordCoreClient->totalShardCount.store(identifyData.shard[1]);
 						}
-						auto theCount = std::thread::hardware_concurrency() > this->discordCoreClient->totalShardCount.load()
-							? this->discordCoreClient->totalShardCount.load()
-							: std::thread::hardware_concurrency();
-						if (theCount < 1) {
-							theCount = 1;
-						}
-						this->discordCoreClient->workerCount.store(theCount);
+						auto theCount = this->discordCoreClient->getConfiguredWorkerCount();
+						theCount = std::clamp<uint64_t>(theCount, 1, std::max<uint64_t>(this->discordCoreClient->totalShardCount.load(), 1));
+						this->discordCoreClient->workerCount.store(static_cast<int32_t>(theCount));
 						theShard->areWeConnected = true;
 						this->discordCoreClient->currentShardIndex.store(identifyData.shard[0]);
 						auto intents = getUint64(theMessage.d, "intents");
@@ -492,26 +999,34 @@ namespace DiscordCoreLoader {
 
 	void BaseSocketAgent::handleBuffer(SSLClient* theShard) noexcept {
 		try {
-			std::string newVector = theShard->getInputBuffer();
+			auto& theBuffer = theShard->getInputBuffer();
 			switch (theShard->theState) {
-				case WebSocketState::Initializing:
-					if (newVector.find("\r\n\r\n") != std::string::npos) {
-						std::string headers = newVector.substr(0, newVector.find("\r\n\r\n"));
-						newVector.erase(0, newVector.find("\r\n\r\n") + 4);
+				case WebSocketState::Initializing: {
+					auto theView = theBuffer.getView();
+					if (auto theHeaderEnd = theView.find("\r\n\r\n"); theHeaderEnd != std::string_view::npos) {
+						std::string headers{ theView.substr(0, theHeaderEnd) };
+						theBuffer.consume(theHeaderEnd + 4);
 						std::vector<std::string> headerOut = tokenize(headers, theShard);
 						if (headerOut.size()) {
 							std::string statusLine = headerOut[0];
 							headerOut.erase(headerOut.begin());
 							std::vector<std::string> status = tokenize(statusLine, theShard, " ");
 							theShard->theState = WebSocketState::Connected;
-							theShard->getInputBuffer().clear();
-							theShard->getInputBuffer().insert(theShard->getInputBuffer().end(), newVector.begin(), newVector.end());
+							while (this->parseHeader(theShard)) {
+							};
 						}
 					}
 					break;
-				case WebSocketState::Connected:
+				}
+				case WebSocketState::Connected: {
 					while (this->parseHeader(theShard)) {
 					};
+					break;
+				}
+				case WebSocketState::Closing: {
+					theBuffer.clear();
+					break;
+				}
 			}
 		} catch (...) {
 			if (this->discordCoreClient->configParser.getTheData().doWePrintWebSocketErrorMessages) {
@@ -523,88 +1038,81 @@ namespace DiscordCoreLoader {
 
 	bool BaseSocketAgent::parseHeader(SSLClient* theShard) noexcept {
 		try {
-			std::string newVector = theShard->getInputBuffer();
-			if (theShard->getInputBuffer().size() < 4) {
+			auto& theBuffer = theShard->getInputBuffer();
+			if (theBuffer.size() < 2) {
 				return false;
-			} else {
-				uint8_t theValue = theShard->getInputBuffer()[0];
-				std::bitset<8> theBits = theValue;
-				theBits.set(7, 0);
-				WebSocketOpCode opCodeNew = static_cast<WebSocketOpCode>(theBits.to_ulong());
-				switch (opCodeNew) {
-					case WebSocketOpCode::Op_Pong: {
-						uint8_t length01 = theShard->getInputBuffer()[1] & (0 << 7);
-						uint32_t payloadStartOffset = 2;
-						theShard->getInputBuffer().erase(theShard->getInputBuffer().begin(),
-							theShard->getInputBuffer().begin() + payloadStartOffset + length01);
-						break;
-					}
-					case WebSocketOpCode::Op_Ping: {
-						if (theShard->getInputBuffer().size() > 2) {
-							uint8_t length01 = theShard->getInputBuffer()[1] & (0 << 7);
-							uint32_t payloadStartOffset = 2;
-							theShard->getInputBuffer().erase(theShard->getInputBuffer().begin(),
-								theShard->getInputBuffer().begin() + payloadStartOffset + length01);
-						}
-						break;
-					}
-					case WebSocketOpCode::Op_Continuation:
-						theShard->getInputBuffer().clear();
-						break;
-					case WebSocketOpCode::Op_Binary:
-					case WebSocketOpCode::Op_Text: {
-						uint8_t length01 = theShard->getInputBuffer()[1];
-						std::bitset<8> theBits02 = length01;
-						theBits02.set(7, 0);
-						uint32_t payloadStartOffset = 2;
-						uint64_t length02 = theBits02.to_ullong();
-						if (length02 == webSocketPayloadLengthMagicLarge) {
-							if (theShard->getInputBuffer().size() < 8) {
-								return false;
-							}
-							uint8_t length03 = theShard->getInputBuffer()[2];
-							uint8_t length04 = theShard->getInputBuffer()[3];
-							length02 = static_cast<uint64_t>((length03 << 8) | length04);
-							payloadStartOffset += 2;
-						} else if (length02 == webSocketPayloadLengthMagicHuge) {
-							if (theShard->getInputBuffer().size() < 10) {
-								return false;
-							}
-							length02 = 0;
-							for (uint64_t value = 2, shift = 56; value < 10; ++value, shift -= 8) {
-								uint8_t length05 = static_cast<uint8_t>(theShard->getInputBuffer()[value]);
-								length02 |= static_cast<uint64_t>(length05) << shift;
-							}
-							payloadStartOffset += 8;
-						}
-						if (theShard->getInputBuffer().size() < payloadStartOffset + length02) {
-							return false;
-						} else {
-							std::string leftOverVector{};
-							leftOverVector.insert(leftOverVector.begin(), theShard->getInputBuffer().begin() + payloadStartOffset + length02 + 4,
-								theShard->getInputBuffer().end());
-							std::string newerVector{};
-							newerVector.insert(newerVector.begin(), theShard->getInputBuffer().begin() + payloadStartOffset + 4,
-								theShard->getInputBuffer().begin() + payloadStartOffset + length02 + 4);
-							this->onMessageReceived(( WebSocketSSLShard* )theShard, newerVector);
-							theShard->getInputBuffer().clear();
-							theShard->getInputBuffer() = leftOverVector;
-						}
-						return true;
-					}
-					case WebSocketOpCode::Op_Close: {
-						uint16_t close = theShard->getInputBuffer()[2] & 0xff;
-						close <<= 8;
-						close |= theShard->getInputBuffer()[3] & 0xff;
-						this->closeCode = close;
-						theShard->getInputBuffer().clear();
-						theShard->disconnect();
-						return false;
-					}
-					default: {
-						this->closeCode = 1000;
-						return false;
+			}
+			auto theData = reinterpret_cast<uint8_t*>(theBuffer.data());
+			WebSocketOpCode opCodeNew = static_cast<WebSocketOpCode>(theData[0] & ~webSocketFinishBit);
+			bool isItMasked = theData[1] & webSocketMaskBit;
+			uint64_t length02 = theData[1] & ~webSocketMaskBit;
+			uint64_t payloadStartOffset = 2;
+			if (length02 == webSocketPayloadLengthMagicLarge) {
+				if (theBuffer.size() < 4) {
+					return false;
+				}
+				length02 = static_cast<uint64_t>((theData[2] << 8) | theData[3]);
+				payloadStartOffset += 2;
+			} else if (length02 == webSocketPayloadLengthMagicHuge) {
+				if (theBuffer.size() < 10) {
+					return false;
+				}
+				length02 = 0;
+				for (uint64_t value = 2, shift = 56; value < 10; ++value, shift -= 8) {
+					length02 |= static_cast<uint64_t>(theData[value]) << shift;
+				}
+				payloadStartOffset += 8;
+			}
+			// Refuse a broken or oversized frame before any of its payload is buffered, and drop whatever the client sends after it.
+			auto theReason = WebSocketCloseCode::Protocol_Error;
+			bool isItRefused = (length02 >> 63) != 0 || !isItMasked;
+			if (!isItRefused && length02 > this->maxFrameSize) {
+				theReason = WebSocketCloseCode::Message_Too_Big;
+				isItRefused = true;
+			}
+			if (isItRefused) {
+				this->initDisconnect(theReason, theShard);
+				theShard->theState = WebSocketState::Closing;
+				theBuffer.clear();
+				return false;
+			}
+			if (theBuffer.size() < payloadStartOffset + 4) {
+				return false;
+			}
+			const char* theMaskKey{ theBuffer.data() + payloadStartOffset };
+			payloadStartOffset += 4;
+			if (theBuffer.size() < payloadStartOffset + length02) {
+				return false;
+			}
+			unmaskPayload(theBuffer.data() + payloadStartOffset, length02, theMaskKey);
+			std::string_view thePayload{ theBuffer.data() + payloadStartOffset, length02 };
+			switch (opCodeNew) {
+				case WebSocketOpCode::Op_Continuation:
+				case WebSocketOpCode::Op_Ping:
+				case WebSocketOpCode::Op_Pong: {
+					theBuffer.consume(payloadStartOffset + length02);
+					return true;
+				}
+				case WebSocketOpCode::Op_Binary:
+				case WebSocketOpCode::Op_Text: {
+					this->onMessageReceived(static_cast<WebSocketSSLShard*>(theShard), thePayload,
+						theBuffer.getPaddedSize() - payloadStartOffset);
+					theBuffer.consume(payloadStartOffset + length02);
+					return true;
+				}
+				case WebSocketOpCode::Op_Close: {
+					uint16_t close{};
+					if (thePayload.size() >= 2) {
+						close = static_cast<uint16_t>((static_cast<uint8_t>(thePayload[0]) << 8) | static_cast<uint8_t>(thePayload[1]));
 					}
+					this->closeCode = close;
+					theBuffer.clear();
+					theShard->disconnect();
+					return false;
+				}
+				default: {
+					this->closeCode = 1000;
+					return false;
 				}
 			}
 		} catch (...) {
@@ -617,9 +1125,11 @@ namespace DiscordCoreLoader {
 	}
 
 	BaseSocketAgent::~BaseSocketAgent() noexcept {
-		this->theTask->request_stop();
-		if (this->theTask->joinable()) {
-			this->theTask->join();
+		if (this->theTask) {
+			this->theTask->request_stop();
+			if (this->theTask->joinable()) {
+				this->theTask->join();
+			}
 		}
 	}
 };
\ No newline at end of file